@@ -23,7 +23,10 @@
 #include <dart/dynamics/Skeleton.hpp>
 #include <dart/simulation/World.hpp>
 
+#include <atomic>
+#include <limits>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -31,6 +34,7 @@
 #include <vector>
 
 #include <ignition/common/Console.hh>
+#include <ignition/physics/FrameData.hh>
 #include <ignition/physics/Implements.hh>
 
 namespace ignition {
@@ -52,6 +56,11 @@ struct ModelInfo
   dart::dynamics::SkeletonPtr model;
   dart::dynamics::SimpleFramePtr frame;
   std::string canonicalLinkName;
+
+  /// \brief True if links, joints or shapes were added to this model since its
+  /// skeleton was last registered with its world. See
+  /// Base::RegisterPendingSkeletons.
+  bool registrationPending = false;
 };
 
 struct LinkInfo
@@ -81,20 +90,82 @@ struct ShapeInfo
   Eigen::Isometry3d tf_offset = Eigen::Isometry3d::Identity();
 };
 
+/// \brief Storage for one type of entity. Entities are stored contiguously in
+/// a dense array and are addressed through a sparse array that is indexed
+/// directly by entity ID, so looking up an entity is two array reads instead of
+/// a hash and a chain of node pointers.
+///
+/// Entity IDs are never reused by Base::GetNextEntity(), so the ID acts as the
+/// generation of its slot: a slot is only valid if the dense entry it points to
+/// still records the same ID. Removing an entity moves the last dense entry
+/// into its place, so removal is O(1) and the dense array never has holes.
+///
+/// The order of the entities within their containers (e.g. the index of a
+/// Model within its World) is tracked so that removing an entity does not
+/// require renumbering every entity that comes after it. See Container.
 template <typename Value1, typename Key2 = Value1>
 struct EntityStorage
 {
-  /// \brief Map from an entity ID to its corresponding object
-  std::unordered_map<std::size_t, Value1> idToObject;
+  /// \brief Marks a slot or an index which does not refer to anything
+  static constexpr std::size_t kInvalid =
+      std::numeric_limits<std::size_t>::max();
+
+  /// \brief A single entity, as stored in the dense array
+  struct Entry
+  {
+    /// \brief The object of this entity
+    Value1 object;
+
+    /// \brief The ID of this entity
+    std::size_t id;
+
+    /// \brief Slot of this entity within Container::ids, if it has a container
+    std::size_t slotInContainer;
+
+    /// \brief ID of the container of this entity, if any
+    std::size_t containerID;
+
+    /// \brief Generation of this entity, which is unique within this storage
+    std::size_t generation;
+  };
+
+  /// \brief Contiguous storage of all the entities
+  std::vector<Entry> entries;
+
+  /// \brief Sparse array from an entity ID to the index of its entry in
+  /// entries, or kInvalid if this storage does not have that entity.
+  std::vector<std::size_t> idToEntry;
+
+  /// \brief Generation to give to the next entity that gets added. It starts
+  /// at 1 because a generation of 0 means that an identity is not checked.
+  std::size_t nextGeneration = 1;
 
   /// \brief Map from an object pointer (or other unique key) to its entity ID
   std::unordered_map<Key2, std::size_t> objectToID;
 
-  using IndexMap = std::unordered_map<std::size_t, std::vector<std::size_t>>;
-  /// \brief The key represents the parent ID. The value represents a vector of
-  /// the objects' IDs. The key of the vector is the object's index within its
-  /// container. This is used by World and Model objects, which don't know their
-  /// own indices within their containers.
+  /// \brief The order of the entities within one container.
+  ///
+  /// Removing an entity leaves an empty slot behind instead of shifting the
+  /// entities that come after it. The empty slots are counted by a Fenwick
+  /// tree, so the index of an entity (its slot minus the number of empty slots
+  /// before it) can be found in O(log n), and the container is compacted once
+  /// more than half of its slots are empty, so the amortized cost of a removal
+  /// does not depend on the number of entities in the container.
+  struct Container
+  {
+    /// \brief IDs of the entities, in the order that they were added.
+    /// Removed entities are left as kInvalid until the next compaction.
+    std::vector<std::size_t> ids;
+
+    /// \brief Fenwick tree over ids which counts the removed entities
+    std::vector<std::size_t> removed;
+
+    /// \brief Total number of removed entities in ids
+    std::size_t numRemoved = 0;
+  };
+
+  /// \brief The key represents the parent ID. This is used by World and Model
+  /// objects, which don't know their own indices within their containers.
   ///
   /// The container type for World is Engine.
   /// The container type for Model is World.
@@ -102,32 +173,51 @@ struct EntityStorage
   /// Links and Joints are contained in Models, but Links and Joints know their
   /// own indices within their Models, so we do not need to use this field for
   /// either of those types.
-  IndexMap indexInContainerToID;
-
-  /// \brief Map from an entity ID to its index within its container
-  std::unordered_map<std::size_t, std::size_t> idToIndexInContainer;
-
-  /// \brief Map from an entity ID to the ID of its container
-  std::unordered_map<std::size_t, std::size_t> idToContainerID;
+  std::unordered_map<std::size_t, Container> containers;
 
+  /// \brief Get the object of an entity, creating a default-constructed one
+  /// if the entity is not in this storage yet.
   Value1 &operator[](const std::size_t _id)
   {
-    return idToObject[_id];
+    if (Entry *entry = this->FindEntry(_id))
+      return entry->object;
+
+    if (_id >= this->idToEntry.size())
+      this->idToEntry.resize(_id + 1, static_cast<std::size_t>(kInvalid));
+
+    this->idToEntry[_id] = this->entries.size();
+    this->entries.push_back(
+          Entry{Value1(), _id, kInvalid, kInvalid, this->nextGeneration++});
+    return this->entries.back().object;
   }
 
   Value1 &at(const std::size_t _id)
   {
-    return idToObject.at(_id);
+    return this->EntryAt(_id).object;
   }
 
   const Value1 &at(const std::size_t _id) const
   {
-    return idToObject.at(_id);
+    return this->EntryAt(_id).object;
+  }
+
+  /// \brief Get a pointer to the object of an entity, or a nullptr if this
+  /// storage does not have that entity.
+  Value1 *Find(const std::size_t _id)
+  {
+    Entry *entry = this->FindEntry(_id);
+    return entry ? &entry->object : nullptr;
+  }
+
+  const Value1 *Find(const std::size_t _id) const
+  {
+    const Entry *entry = this->FindEntry(_id);
+    return entry ? &entry->object : nullptr;
   }
 
   std::size_t size() const
   {
-    return idToObject.size();
+    return this->entries.size();
   }
 
   std::size_t IdentityOf(const Key2 &_key) const
@@ -135,6 +225,14 @@ struct EntityStorage
     return objectToID.at(_key);
   }
 
+  /// \brief Get the entity ID of a key, or kInvalid if no entity has it. This
+  /// saves a second lookup compared to HasEntity followed by IdentityOf.
+  std::size_t FindIdentity(const Key2 &_key) const
+  {
+    const auto it = this->objectToID.find(_key);
+    return it == this->objectToID.end() ? kInvalid : it->second;
+  }
+
   bool HasEntity(const Key2 &_key) const
   {
     return objectToID.find(_key) != objectToID.end();
@@ -142,7 +240,217 @@ struct EntityStorage
 
   bool HasEntity(const std::size_t _id) const
   {
-    return idToObject.find(_id) != idToObject.end();
+    return this->FindEntry(_id) != nullptr;
+  }
+
+  /// \brief Get the generation of an entity. Every entity that is ever added
+  /// to this storage gets a different generation.
+  /// \return The generation, or 0 if this storage does not have the entity
+  std::size_t Generation(const std::size_t _id) const
+  {
+    const Entry *entry = this->FindEntry(_id);
+    return entry ? entry->generation : 0u;
+  }
+
+  /// \brief Append an entity to the end of a container
+  void AddToContainer(const std::size_t _id, const std::size_t _containerID)
+  {
+    Entry &entry = this->EntryAt(_id);
+    Container &container = this->containers[_containerID];
+
+    const std::size_t slot = container.ids.size();
+    container.ids.push_back(_id);
+
+    // The new node of the Fenwick tree covers the slots in the range
+    // (node - LowBit(node), node], all of which except for the new one already
+    // exist.
+    const std::size_t node = slot + 1;
+    container.removed.push_back(
+          RemovedBefore(container, slot)
+          - RemovedBefore(container, node - LowBit(node)));
+
+    entry.containerID = _containerID;
+    entry.slotInContainer = slot;
+  }
+
+  /// \brief Get the index of an entity within its container
+  std::size_t IndexInContainer(const std::size_t _id) const
+  {
+    const Entry &entry = this->EntryAt(_id);
+    const Container &container = this->containers.at(entry.containerID);
+    return entry.slotInContainer
+        - RemovedBefore(container, entry.slotInContainer);
+  }
+
+  /// \brief Get the ID of the entity at an index within a container
+  /// \return The ID of the entity, or kInvalid if the index is out of range
+  std::size_t IdInContainer(
+      const std::size_t _containerID, const std::size_t _index) const
+  {
+    const auto it = this->containers.find(_containerID);
+    if (it == this->containers.end())
+      return kInvalid;
+
+    const Container &container = it->second;
+    const std::size_t numSlots = container.ids.size();
+    if (_index >= numSlots - container.numRemoved)
+      return kInvalid;
+
+    if (container.numRemoved == 0)
+      return container.ids[_index];
+
+    // Descend the Fenwick tree to find the longest run of leading slots which
+    // holds no more than _index live entities. The slot right after that run
+    // is the one we are looking for.
+    std::size_t step = 1;
+    while (2 * step <= numSlots)
+      step *= 2;
+
+    std::size_t slot = 0;
+    std::size_t remaining = _index;
+    for (; step > 0; step /= 2)
+    {
+      const std::size_t next = slot + step;
+      if (next > numSlots)
+        continue;
+
+      const std::size_t live = step - container.removed[next - 1];
+      if (live <= remaining)
+      {
+        slot = next;
+        remaining -= live;
+      }
+    }
+
+    return container.ids[slot];
+  }
+
+  /// \brief Get the number of entities within a container
+  std::size_t ContainerSize(const std::size_t _containerID) const
+  {
+    const auto it = this->containers.find(_containerID);
+    if (it == this->containers.end())
+      return 0;
+
+    return it->second.ids.size() - it->second.numRemoved;
+  }
+
+  /// \brief Get the ID of the container of an entity
+  std::size_t ContainerID(const std::size_t _id) const
+  {
+    return this->EntryAt(_id).containerID;
+  }
+
+  /// \brief Remove an entity and its key from this storage, including from
+  /// its container, if it has one.
+  void Erase(const std::size_t _id, const Key2 &_key)
+  {
+    this->objectToID.erase(_key);
+
+    const Entry *entry = this->FindEntry(_id);
+    if (!entry)
+      return;
+
+    if (entry->containerID != kInvalid)
+      this->RemoveFromContainer(*entry);
+
+    const std::size_t index = this->idToEntry[_id];
+    if (index + 1 != this->entries.size())
+    {
+      this->entries[index] = std::move(this->entries.back());
+      this->idToEntry[this->entries[index].id] = index;
+    }
+
+    this->entries.pop_back();
+    this->idToEntry[_id] = kInvalid;
+  }
+
+  private: static std::size_t LowBit(const std::size_t _node)
+  {
+    return _node & (~_node + 1);
+  }
+
+  /// \brief Count the removed entities in the slots before _slot
+  private: static std::size_t RemovedBefore(
+      const Container &_container, const std::size_t _slot)
+  {
+    std::size_t count = 0;
+    for (std::size_t node = _slot; node > 0; node -= LowBit(node))
+      count += _container.removed[node - 1];
+
+    return count;
+  }
+
+  private: void RemoveFromContainer(const Entry &_entry)
+  {
+    Container &container = this->containers.at(_entry.containerID);
+
+    const std::size_t numSlots = container.ids.size();
+    for (std::size_t node = _entry.slotInContainer + 1; node <= numSlots;
+         node += LowBit(node))
+    {
+      ++container.removed[node - 1];
+    }
+
+    container.ids[_entry.slotInContainer] = kInvalid;
+    ++container.numRemoved;
+
+    if (2 * container.numRemoved > numSlots)
+      this->Compact(container);
+  }
+
+  /// \brief Drop the empty slots of a container
+  private: void Compact(Container &_container)
+  {
+    std::size_t numSlots = 0;
+    for (const std::size_t id : _container.ids)
+    {
+      if (id == kInvalid)
+        continue;
+
+      this->EntryAt(id).slotInContainer = numSlots;
+      _container.ids[numSlots++] = id;
+    }
+
+    _container.ids.resize(numSlots);
+    _container.removed.assign(numSlots, 0);
+    _container.numRemoved = 0;
+  }
+
+  private: Entry *FindEntry(const std::size_t _id)
+  {
+    return const_cast<Entry*>(
+          static_cast<const EntityStorage*>(this)->FindEntry(_id));
+  }
+
+  private: const Entry *FindEntry(const std::size_t _id) const
+  {
+    if (_id >= this->idToEntry.size())
+      return nullptr;
+
+    const std::size_t index = this->idToEntry[_id];
+    if (index == kInvalid || this->entries[index].id != _id)
+      return nullptr;
+
+    return &this->entries[index];
+  }
+
+  private: Entry &EntryAt(const std::size_t _id)
+  {
+    return const_cast<Entry&>(
+          static_cast<const EntityStorage*>(this)->EntryAt(_id));
+  }
+
+  private: const Entry &EntryAt(const std::size_t _id) const
+  {
+    const Entry *entry = this->FindEntry(_id);
+    if (!entry)
+    {
+      throw std::out_of_range(
+            "EntityStorage does not have entity [" + std::to_string(_id) + "]");
+    }
+
+    return *entry;
   }
 };
 
@@ -168,10 +476,6 @@ class Base : public Implements3d<FeatureList<Feature>>
   {
     this->GetNextEntity();
 
-    // Create a 0th entry in this map
-    this->worlds.indexInContainerToID.insert(
-          std::make_pair(0u, std::vector<std::size_t>()));
-
     // dartsim does not have multiple "engines"
     return this->GenerateIdentity(0);
   }
@@ -188,16 +492,10 @@ class Base : public Implements3d<FeatureList<Feature>>
   {
     const std::size_t id = this->GetNextEntity();
 
-    this->worlds.idToObject[id] = _world;
+    this->worlds[id] = _world;
     this->worlds.objectToID[_name] = id;
 
-    std::vector<std::size_t> &indexInContainerToID =
-        this->worlds.indexInContainerToID.at(0);
-
-    this->worlds.idToIndexInContainer[id] = indexInContainerToID.size();
-    indexInContainerToID.push_back(id);
-
-    this->worlds.idToContainerID[id] = 0;
+    this->worlds.AddToContainer(id, 0);
 
     _world->setName(_name);
 
@@ -208,22 +506,16 @@ class Base : public Implements3d<FeatureList<Feature>>
       const ModelInfo &_info, const std::size_t _worldID)
   {
     const std::size_t id = this->GetNextEntity();
-    this->models.idToObject[id] = std::make_shared<ModelInfo>(_info);
-    ModelInfo &entry = *this->models.idToObject[id];
+    this->models[id] = std::make_shared<ModelInfo>(_info);
+    ModelInfo &entry = *this->models.at(id);
     this->models.objectToID[_info.model] = id;
 
-    const dart::simulation::WorldPtr &world = worlds[_worldID];
+    const dart::simulation::WorldPtr &world = worlds.at(_worldID);
 
-    const std::size_t indexInWorld = world->getNumSkeletons();
-    this->models.idToIndexInContainer[id] = indexInWorld;
-    std::vector<std::size_t> &indexInContainerToID =
-        this->models.indexInContainerToID[_worldID];
-    indexInContainerToID.push_back(id);
+    this->models.AddToContainer(id, _worldID);
     world->addSkeleton(entry.model);
 
-    this->models.idToContainerID[id] = _worldID;
-
-    assert(indexInContainerToID.size() == world->getNumSkeletons());
+    assert(this->models.ContainerSize(_worldID) == world->getNumSkeletons());
 
     return std::forward_as_tuple(id, entry);
   }
@@ -231,8 +523,8 @@ class Base : public Implements3d<FeatureList<Feature>>
   public: inline std::size_t AddLink(DartBodyNode *_bn)
   {
     const std::size_t id = this->GetNextEntity();
-    this->links.idToObject[id] = std::make_shared<LinkInfo>();
-    this->links.idToObject[id]->link = _bn;
+    this->links[id] = std::make_shared<LinkInfo>();
+    this->links.at(id)->link = _bn;
     this->links.objectToID[_bn] = id;
     this->frames[id] = _bn;
 
@@ -244,8 +536,8 @@ class Base : public Implements3d<FeatureList<Feature>>
   public: inline std::size_t AddJoint(DartJoint *_joint)
   {
     const std::size_t id = this->GetNextEntity();
-    this->joints.idToObject[id] = std::make_shared<JointInfo>();
-    this->joints.idToObject[id]->joint = _joint;
+    this->joints[id] = std::make_shared<JointInfo>();
+    this->joints.at(id)->joint = _joint;
     this->joints.objectToID[_joint] = id;
 
     this->UpdateSkeletonInWorld(_joint->getSkeleton());
@@ -257,7 +549,7 @@ class Base : public Implements3d<FeatureList<Feature>>
       const ShapeInfo &_info)
   {
     const std::size_t id = this->GetNextEntity();
-    this->shapes.idToObject[id] = std::make_shared<ShapeInfo>(_info);
+    this->shapes[id] = std::make_shared<ShapeInfo>(_info);
     this->shapes.objectToID[_info.node] = id;
     this->frames[id] = _info.node.get();
 
@@ -270,60 +562,141 @@ class Base : public Implements3d<FeatureList<Feature>>
                                const std::size_t _modelID)
   {
     const auto &world = this->worlds.at(_worldID);
-    const std::size_t modelIndex = this->models.idToIndexInContainer[_modelID];
 
     auto skel = this->models.at(_modelID)->model;
     world->removeSkeleton(skel);
 
     // house keeping
-    // The key in indexInContainerToID is the index of the vector so erasing the
-    // element automatically decrements the index of the rest of the elements of
-    // the vector. The indices in idToIndexInContainer, however, are stored as
-    // numbers (as values in the map). We need to decrement all the indices
-    // greater than the index of the model we are removing.
-    for (auto it = this->models.indexInContainerToID[_worldID].begin() +
-                   modelIndex + 1;
-         it != this->models.indexInContainerToID[_worldID].end(); ++it)
+    // Erasing the model leaves the indices of the models that come after it
+    // untouched; EntityStorage accounts for the gap when their indices are
+    // requested.
+    this->models.Erase(_modelID, skel);
+
+    // Erase the links, joints and shapes of the model as well, so that they
+    // no longer keep the skeleton alive and borrowed identities of them
+    // expire.
+    for (std::size_t i = 0; i < skel->getNumBodyNodes(); ++i)
+    {
+      const DartBodyNode *bn = skel->getBodyNode(i);
+      for (std::size_t j = 0; j < bn->getNumShapeNodes(); ++j)
+        this->EraseEntity(this->shapes, bn->getShapeNode(j));
+
+      this->EraseEntity(this->links, bn);
+    }
+
+    for (std::size_t i = 0; i < skel->getNumJoints(); ++i)
     {
-      // decrement the index (the value of the map)
-      --this->models.idToIndexInContainer[*it];
+      const DartJoint *joint = skel->getJoint(i);
+      this->EraseEntity(this->joints, joint);
     }
 
-    this->models.idToIndexInContainer.erase(_modelID);
+    // The cache may hold the data of the links and shapes of the model
+    if (!this->frameDataCache.empty())
+      this->frameDataCache.clear();
+
+    assert(this->models.ContainerSize(_worldID) == world->getNumSkeletons());
+  }
+
+  /// \brief Erase an entity from its storage and from the frames, if the
+  /// storage has it
+  private: template <typename Value, typename Key>
+  void EraseEntity(EntityStorage<Value, Key> &_storage, const Key &_key)
+  {
+    const std::size_t id = _storage.FindIdentity(_key);
+    if (id == _storage.kInvalid)
+      return;
 
-    this->models.indexInContainerToID[_worldID].erase(
-        this->models.indexInContainerToID[_worldID].begin() + modelIndex);
+    _storage.Erase(id, _key);
+    this->frames.erase(id);
+  }
 
-    this->models.idToContainerID.erase(_modelID);
+  /// \brief Register the skeletons of a world which have had links, joints or
+  /// shapes added to them since they were last registered, so that the world
+  /// (in particular its collision detector) picks up the new entities. This
+  /// must be called before anything that depends on the world knowing about
+  /// every entity of its skeletons, such as stepping the world.
+  public: void RegisterPendingSkeletons(const std::size_t _worldID)
+  {
+    const auto it = this->pendingSkeletons.find(_worldID);
+    if (it == this->pendingSkeletons.end() || it->second.empty())
+      return;
 
-    this->models.idToObject.erase(_modelID);
-    this->models.objectToID.erase(skel);
+    const DartWorldPtr &world = this->worlds.at(_worldID);
+    for (const DartSkeletonPtr &skel : it->second)
+    {
+      // The model may have been removed since it was scheduled
+      if (!this->models.HasEntity(skel))
+        continue;
+
+      this->models.at(this->models.IdentityOf(skel))->registrationPending =
+          false;
+
+      // The skeleton is already in the world, so we remove and add it again.
+      if (world->hasSkeleton(skel))
+      {
+        world->removeSkeleton(skel);
+        world->addSkeleton(skel);
+      }
+      else
+      {
+        ignerr << "Given a skeleton to update, but skeleton was not found in "
+               << "world. This should not be possible! Please report this "
+               << "bug!\n";
+        assert(false);
+      }
+    }
 
-    assert(this->models.indexInContainerToID[_worldID].size() ==
-           world->getNumSkeletons());
+    it->second.clear();
   }
 
+  /// \brief Schedule a skeleton to be registered with its world again. This is
+  /// deferred until RegisterPendingSkeletons is called, so constructing a
+  /// model registers its skeleton once, no matter how many links, joints and
+  /// shapes it has, instead of once per entity.
   private: void UpdateSkeletonInWorld(const DartSkeletonPtr &_skel)
   {
-    // If the skeleton is not added to the world, add it. Otherwise, remove and
-    // add it again.
-
     // Find the world the skeleton belongs to by finding the model first
     const std::size_t modelID = this->models.objectToID.at(_skel);
-    const std::size_t worldID = this->models.idToContainerID.at(modelID);
-    const DartWorldPtr &world = this->worlds.at(worldID);
+    ModelInfo &modelInfo = *this->models.at(modelID);
+    if (modelInfo.registrationPending)
+      return;
 
-    if (world->hasSkeleton(_skel))
-    {
-      world->removeSkeleton(_skel);
-      world->addSkeleton(_skel);
-    }
-    else
-    {
-      ignerr << "Given a skeleton to update, but skeleton was not found in "
-             << "world. This should not be possible! Please report this bug!\n";
-      assert(false);
-    }
+    modelInfo.registrationPending = true;
+    const std::size_t worldID = this->models.ContainerID(modelID);
+    this->pendingSkeletons[worldID].push_back(_skel);
+  }
+
+  /// \brief Mark the cached FrameData of every frame as outdated. This must
+  /// be called by anything that can change the pose, velocity or
+  /// acceleration of a frame.
+  public: void InvalidateFrameDataCache()
+  {
+    ++this->frameDataVersion;
+  }
+
+  /// \brief Generate an identity which borrows the info of an entity from
+  /// _storage instead of sharing ownership of it. This is meant for entities
+  /// that are handed out on every step, such as the shapes of contacts. The
+  /// identity is stamped with the generation of the entity, so using it
+  /// after the entity was removed throws instead of reading freed info.
+  public: template <typename Value1, typename Key2>
+  Identity GenerateBorrowedIdentityFromStorage(
+      const std::size_t _id,
+      const EntityStorage<Value1, Key2> &_storage) const
+  {
+    return this->GenerateBorrowedIdentity(
+          _id, _storage.at(_id).get(), _storage.Generation(_id));
+  }
+
+  // Documentation inherited
+  protected: bool IsCurrentGeneration(
+      const Identity &_identity) const override
+  {
+    const std::size_t id = _identity.id;
+    const std::size_t generation = _identity.generation;
+    return this->shapes.Generation(id) == generation
+        || this->links.Generation(id) == generation
+        || this->joints.Generation(id) == generation;
   }
 
   public: EntityStorage<DartWorldPtr, std::string> worlds;
@@ -332,6 +705,32 @@ class Base : public Implements3d<FeatureList<Feature>>
   public: EntityStorage<JointInfoPtr, const DartJoint*> joints;
   public: EntityStorage<ShapeInfoPtr, const DartShapeNode*> shapes;
   public: std::unordered_map<std::size_t, const dart::dynamics::Frame*> frames;
+
+  /// \brief Map from a world ID to the skeletons of that world which are
+  /// waiting to be registered again. See RegisterPendingSkeletons.
+  public: std::unordered_map<std::size_t, std::vector<DartSkeletonPtr>>
+      pendingSkeletons;
+
+  /// \brief FrameData of a frame, along with the frameDataVersion at the time
+  /// it was computed.
+  public: struct CachedFrameData
+  {
+    std::size_t version = 0;
+    FrameData3d data;
+  };
+
+  /// \brief Whether FrameDataRelativeToWorld may use frameDataCache
+  public: bool frameDataCacheEnabled = false;
+
+  /// \brief Incremented every time the cached FrameData becomes outdated. It
+  /// starts at 1 so that newly inserted cache entries are outdated, and it is
+  /// atomic because worlds that are stepped concurrently all invalidate the
+  /// cache.
+  public: std::atomic<std::size_t> frameDataVersion{1};
+
+  /// \brief Map from a frame ID to its most recently computed FrameData
+  public: mutable std::unordered_map<std::size_t, CachedFrameData>
+      frameDataCache;
 };
 
 }
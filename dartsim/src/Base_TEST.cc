@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Base.hh"
+
+using ignition::physics::dartsim::EntityStorage;
+
+/////////////////////////////////////////////////
+TEST(EntityStorage, InsertAndLookup)
+{
+  EntityStorage<std::string, std::string> storage;
+  EXPECT_EQ(0u, storage.size());
+  EXPECT_FALSE(storage.HasEntity(3u));
+  EXPECT_EQ(nullptr, storage.Find(3u));
+  EXPECT_THROW(storage.at(3u), std::out_of_range);
+
+  storage[3u] = "three";
+  storage.objectToID["three"] = 3u;
+  storage[10u] = "ten";
+  storage.objectToID["ten"] = 10u;
+
+  EXPECT_EQ(2u, storage.size());
+  EXPECT_TRUE(storage.HasEntity(3u));
+  EXPECT_TRUE(storage.HasEntity(10u));
+  EXPECT_FALSE(storage.HasEntity(4u));
+  EXPECT_FALSE(storage.HasEntity(100u));
+  EXPECT_EQ("three", storage.at(3u));
+  EXPECT_EQ("ten", *storage.Find(10u));
+  EXPECT_TRUE(storage.HasEntity(std::string("ten")));
+  EXPECT_EQ(10u, storage.IdentityOf("ten"));
+
+  storage.AddToContainer(10u, 1u);
+  storage.AddToContainer(3u, 1u);
+  EXPECT_EQ(1u, storage.ContainerID(10u));
+  EXPECT_EQ(0u, storage.IndexInContainer(10u));
+  EXPECT_EQ(1u, storage.IndexInContainer(3u));
+  EXPECT_EQ(2u, storage.ContainerSize(1u));
+  EXPECT_EQ(0u, storage.ContainerSize(2u));
+  EXPECT_EQ(3u, storage.IdInContainer(1u, 1u));
+  EXPECT_EQ(storage.kInvalid, storage.IdInContainer(1u, 2u));
+  EXPECT_EQ(storage.kInvalid, storage.IdInContainer(2u, 0u));
+}
+
+/////////////////////////////////////////////////
+TEST(EntityStorage, Erase)
+{
+  EntityStorage<std::string, std::string> storage;
+  for (std::size_t id = 0; id < 5; ++id)
+  {
+    storage[id] = std::to_string(id);
+    storage.objectToID[std::to_string(id)] = id;
+    storage.AddToContainer(id, 100u);
+  }
+
+  // Erasing from the middle moves the last entry into the freed spot, which
+  // must not change what the remaining IDs refer to.
+  storage.Erase(1u, "1");
+  EXPECT_EQ(4u, storage.size());
+  EXPECT_FALSE(storage.HasEntity(1u));
+  EXPECT_FALSE(storage.HasEntity(std::string("1")));
+  EXPECT_THROW(storage.IndexInContainer(1u), std::out_of_range);
+
+  EXPECT_EQ(4u, storage.ContainerSize(100u));
+
+  for (const std::size_t id : {0u, 2u, 3u, 4u})
+  {
+    ASSERT_TRUE(storage.HasEntity(id));
+    EXPECT_EQ(std::to_string(id), storage.at(id));
+    EXPECT_EQ(100u, storage.ContainerID(id));
+
+    // The entities after the erased one move up by one
+    const std::size_t index = id == 0u ? 0u : id - 1u;
+    EXPECT_EQ(index, storage.IndexInContainer(id));
+    EXPECT_EQ(id, storage.IdInContainer(100u, index));
+  }
+
+  // Erasing the last entry, and erasing an entity twice
+  storage.Erase(4u, "4");
+  storage.Erase(4u, "4");
+  EXPECT_EQ(3u, storage.size());
+  EXPECT_EQ(3u, storage.ContainerSize(100u));
+  EXPECT_FALSE(storage.HasEntity(4u));
+  EXPECT_EQ("3", storage.at(3u));
+}
+
+/////////////////////////////////////////////////
+TEST(EntityStorage, ContainerIndices)
+{
+  // Remove entities from a container in an order that exercises both the
+  // empty slots and the compaction, and compare against a plain vector.
+  EntityStorage<std::string, std::string> storage;
+  std::vector<std::size_t> expected;
+  std::size_t nextID = 1;
+
+  const auto add = [&]()
+  {
+    const std::size_t id = nextID++;
+    storage[id] = std::to_string(id);
+    storage.objectToID[std::to_string(id)] = id;
+    storage.AddToContainer(id, 0u);
+    expected.push_back(id);
+  };
+
+  const auto check = [&]()
+  {
+    ASSERT_EQ(expected.size(), storage.ContainerSize(0u));
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+      EXPECT_EQ(i, storage.IndexInContainer(expected[i]));
+      EXPECT_EQ(expected[i], storage.IdInContainer(0u, i));
+    }
+  };
+
+  for (std::size_t i = 0; i < 37; ++i)
+    add();
+  check();
+
+  for (const std::size_t index : {5u, 0u, 30u, 12u, 12u, 1u, 29u})
+  {
+    const std::size_t id = expected[index];
+    storage.Erase(id, std::to_string(id));
+    expected.erase(expected.begin() + index);
+    check();
+  }
+
+  for (std::size_t i = 0; i < 9; ++i)
+    add();
+  check();
+
+  while (expected.size() > 3)
+  {
+    const std::size_t index = expected.size() / 2;
+    const std::size_t id = expected[index];
+    storage.Erase(id, std::to_string(id));
+    expected.erase(expected.begin() + index);
+    check();
+  }
+
+  add();
+  check();
+}
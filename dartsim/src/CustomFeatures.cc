@@ -25,6 +25,9 @@ namespace dartsim {
 dart::simulation::WorldPtr CustomFeatures::GetDartsimWorld(
     const Identity &_worldID)
 {
+  // Callers may use the collision detector of the world directly, so it needs
+  // to know about every entity.
+  this->RegisterPendingSkeletons(_worldID);
   return this->worlds.at(_worldID);
 }
 
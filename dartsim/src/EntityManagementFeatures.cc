@@ -89,9 +89,11 @@ std::size_t EntityManagementFeatures::GetWorldCount(
 Identity EntityManagementFeatures::GetWorld(
     const Identity &, std::size_t _worldIndex) const
 {
-  const std::size_t id =
-      this->worlds.indexInContainerToID.begin()->second[_worldIndex];
-  return this->GenerateIdentity(id, this->worlds.idToObject.at(id));
+  const std::size_t id = this->worlds.IdInContainer(0, _worldIndex);
+  if (!this->worlds.HasEntity(id))
+    return this->GenerateInvalidId();
+
+  return this->GenerateIdentity(id, this->worlds.at(id));
 }
 
 /////////////////////////////////////////////////
@@ -99,7 +101,7 @@ Identity EntityManagementFeatures::GetWorld(
     const Identity &, const std::string &_worldName) const
 {
   const std::size_t id = this->worlds.IdentityOf(_worldName);
-  return this->GenerateIdentity(id, this->worlds.idToObject.at(id));
+  return this->GenerateIdentity(id, this->worlds.at(id));
 }
 
 /////////////////////////////////////////////////
@@ -114,7 +116,7 @@ std::size_t EntityManagementFeatures::GetWorldIndex(
     const Identity &_worldID) const
 {
   // TODO(anyone) this will throw if the world has been removed
-  return this->worlds.idToIndexInContainer.at(_worldID);
+  return this->worlds.IndexInContainer(_worldID);
 }
 
 /////////////////////////////////////////////////
@@ -135,14 +137,15 @@ std::size_t EntityManagementFeatures::GetModelCount(
 Identity EntityManagementFeatures::GetModel(
     const Identity &_worldID, const std::size_t _modelIndex) const
 {
-  const DartSkeletonPtr &model =
-      this->ReferenceInterface<DartWorld>(_worldID)->getSkeleton(_modelIndex);
+  // The skeletons of a world may be reordered when they get registered with
+  // the world again, so the index of a model is looked up in "models" rather
+  // than in the dartsim world.
+  const std::size_t modelID = this->models.IdInContainer(_worldID, _modelIndex);
 
   // If the model doesn't exist in "models", it means the containing entity has
   // been removed.
-  if (this->models.HasEntity(model))
+  if (this->models.HasEntity(modelID))
   {
-    const std::size_t modelID = this->models.IdentityOf(model);
     return this->GenerateIdentity(modelID, this->models.at(modelID));
   }
   else
@@ -185,7 +188,7 @@ std::size_t EntityManagementFeatures::GetModelIndex(
   // TODO(anyone) this will throw if the model has been removed. The alternative
   // is to first check if the model exists, but what should we return if it
   // doesn't exist
-  return this->models.idToIndexInContainer.at(_modelID);
+  return this->models.IndexInContainer(_modelID);
 }
 
 /////////////////////////////////////////////////
@@ -195,7 +198,7 @@ Identity EntityManagementFeatures::GetWorldOfModel(
   // If the model doesn't exist in "models", it it has been removed.
   if (this->models.HasEntity(_modelID))
   {
-    const std::size_t worldID = this->models.idToContainerID.at(_modelID);
+    const std::size_t worldID = this->models.ContainerID(_modelID);
     return this->GenerateIdentity(worldID, this->worlds.at(worldID));
   }
   else
@@ -487,12 +490,11 @@ Identity EntityManagementFeatures::GetLinkOfShape(
 bool EntityManagementFeatures::RemoveModelByIndex(const Identity &_worldID,
                                                   std::size_t _modelIndex)
 {
-  auto *const world = this->ReferenceInterface<DartWorld>(_worldID);
-  const DartSkeletonPtr &model = world->getSkeleton(_modelIndex);
+  const std::size_t modelID = this->models.IdInContainer(_worldID, _modelIndex);
 
-  if (model != nullptr && this->models.HasEntity(model))
+  if (this->models.HasEntity(modelID))
   {
-    this->RemoveModelImpl(_worldID, this->models.IdentityOf(model));
+    this->RemoveModelImpl(_worldID, modelID);
     return true;
   }
   return false;
@@ -518,7 +520,7 @@ bool EntityManagementFeatures::RemoveModel(const Identity &_modelID)
 {
   if (this->models.HasEntity(_modelID))
   {
-    this->RemoveModelImpl(this->models.idToContainerID.at(_modelID), _modelID);
+    this->RemoveModelImpl(this->models.ContainerID(_modelID), _modelID);
     return true;
   }
   return false;
@@ -530,6 +532,26 @@ bool EntityManagementFeatures::ModelRemoved(const Identity &_modelID) const
   return !this->models.HasEntity(_modelID);
 }
 
+/////////////////////////////////////////////////
+std::size_t EntityManagementFeatures::RemoveModels(
+    const Identity &_worldID, const std::vector<Identity> &_modelIDs)
+{
+  std::size_t numRemoved = 0;
+  for (const Identity &modelID : _modelIDs)
+  {
+    if (!this->models.HasEntity(modelID) ||
+        this->models.ContainerID(modelID) != _worldID.id)
+    {
+      continue;
+    }
+
+    this->RemoveModelImpl(_worldID, modelID);
+    ++numRemoved;
+  }
+
+  return numRemoved;
+}
+
 /////////////////////////////////////////////////
 Identity EntityManagementFeatures::ConstructEmptyWorld(
     const Identity &/*_engineID*/, const std::string &_name)
@@ -538,7 +560,7 @@ Identity EntityManagementFeatures::ConstructEmptyWorld(
   world->getConstraintSolver()->setCollisionDetector(
         dart::collision::OdeCollisionDetector::create());
 
-  // TODO(anyone) We need a machanism to configure maxNumContacts at runtime.
+  // This can be changed at runtime through the WorldMaxContacts feature.
   auto &collOpt = world->getConstraintSolver()->getCollisionOption();
   collOpt.maxNumContacts = 10000;
 
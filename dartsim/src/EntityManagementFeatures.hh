@@ -19,6 +19,7 @@
 #define IGNITION_PHYSICS_DARTSIM_SRC_GETENTITIESFEATURE_HH_
 
 #include <string>
+#include <vector>
 
 #include <ignition/physics/ConstructEmpty.hh>
 #include <ignition/physics/GetEntities.hh>
@@ -135,6 +136,10 @@ class EntityManagementFeatures :
 
   public: bool ModelRemoved(const Identity &_modelID) const override;
 
+  public: std::size_t RemoveModels(
+      const Identity &_worldID,
+      const std::vector<Identity> &_modelIDs) override;
+
   // ----- Construct empty entities -----
   public: Identity ConstructEmptyWorld(
       const Identity &_engineID, const std::string &_name) override;
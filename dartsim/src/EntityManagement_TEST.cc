@@ -17,6 +17,12 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
+#include <dart/collision/CollisionGroup.hpp>
+#include <dart/constraint/ConstraintSolver.hpp>
+
 #include <ignition/plugin/Loader.hh>
 
 #include <ignition/common/MeshManager.hh>
@@ -27,16 +33,20 @@
 #include <ignition/physics/RequestEngine.hh>
 #include <ignition/physics/RevoluteJoint.hh>
 
+#include "CustomFeatures.hh"
 #include "EntityManagementFeatures.hh"
 #include "JointFeatures.hh"
 #include "KinematicsFeatures.hh"
 #include "ShapeFeatures.hh"
+#include "SimulationFeatures.hh"
 
 struct TestFeatureList : ignition::physics::FeatureList<
+    ignition::physics::dartsim::CustomFeatureList,
     ignition::physics::dartsim::EntityManagementFeatureList,
     ignition::physics::dartsim::JointFeatureList,
     ignition::physics::dartsim::KinematicsFeatureList,
-    ignition::physics::dartsim::ShapeFeatureList
+    ignition::physics::dartsim::ShapeFeatureList,
+    ignition::physics::dartsim::SimulationFeatureList
 > { };
 
 TEST(EntityManagement_TEST, ConstructEmptyWorld)
@@ -221,6 +231,116 @@ TEST(EntityManagement_TEST, RemoveEntities)
   EXPECT_EQ(0ul, world->GetModelCount());
 }
 
+TEST(EntityManagement_TEST, RemoveModels)
+{
+  ignition::plugin::Loader loader;
+  loader.LoadLib(dartsim_plugin_LIB);
+
+  ignition::plugin::PluginPtr dartsim =
+      loader.Instantiate("ignition::physics::dartsim::Plugin");
+
+  auto engine =
+      ignition::physics::RequestEngine3d<TestFeatureList>::From(dartsim);
+  ASSERT_NE(nullptr, engine);
+
+  auto world = engine->ConstructEmptyWorld("world");
+  auto otherWorld = engine->ConstructEmptyWorld("other world");
+  auto otherModel = otherWorld->ConstructEmptyModel("other model");
+
+  using ModelPtr = ignition::physics::Model3dPtr<TestFeatureList>;
+  std::vector<ModelPtr> models;
+  for (std::size_t i = 0; i < 10; ++i)
+    models.push_back(world->ConstructEmptyModel("model" + std::to_string(i)));
+
+  // A model from another world and a model that is given twice are skipped
+  EXPECT_EQ(3u, world->RemoveModels(
+      {models[1], models[4], models[4], models[8], otherModel}));
+  EXPECT_EQ(7u, world->GetModelCount());
+  EXPECT_FALSE(otherModel->Removed());
+  EXPECT_TRUE(models[1]->Removed());
+  EXPECT_TRUE(models[4]->Removed());
+  EXPECT_TRUE(models[8]->Removed());
+
+  // The remaining models keep their order
+  const std::vector<std::size_t> remaining = {0, 2, 3, 5, 6, 7, 9};
+  for (std::size_t i = 0; i < remaining.size(); ++i)
+  {
+    const auto &model = models[remaining[i]];
+    EXPECT_EQ(i, model->GetIndex());
+    EXPECT_EQ(model->GetName(), world->GetModel(i)->GetName());
+  }
+
+  // Models can still be added and removed one at a time afterwards
+  auto last = world->ConstructEmptyModel("last");
+  EXPECT_EQ(7u, last->GetIndex());
+  EXPECT_TRUE(models[0]->Remove());
+  EXPECT_EQ(6u, last->GetIndex());
+  EXPECT_EQ(0u, models[2]->GetIndex());
+  EXPECT_EQ("last", world->GetModel(6)->GetName());
+  EXPECT_EQ(1u, otherWorld->GetModelCount());
+  EXPECT_EQ(1u, engine->GetWorld(1)->GetModelCount());
+}
+
+TEST(EntityManagement_TEST, DeferredSkeletonRegistration)
+{
+  ignition::plugin::Loader loader;
+  loader.LoadLib(dartsim_plugin_LIB);
+
+  ignition::plugin::PluginPtr dartsim =
+      loader.Instantiate("ignition::physics::dartsim::Plugin");
+
+  auto engine =
+      ignition::physics::RequestEngine3d<TestFeatureList>::From(dartsim);
+  ASSERT_NE(nullptr, engine);
+
+  auto world = engine->ConstructEmptyWorld("world");
+  auto model0 = world->ConstructEmptyModel("model0");
+  auto model1 = world->ConstructEmptyModel("model1");
+
+  // Populate the first model after the second one has been created, so that
+  // registering its skeleton again moves it behind the second one in dartsim.
+  for (std::size_t i = 0; i < 5; ++i)
+  {
+    auto link = model0->ConstructEmptyLink("link" + std::to_string(i));
+    link->AttachBoxShape("box" + std::to_string(i), Eigen::Vector3d::Ones());
+  }
+
+  // Retrieving the dartsim world registers the pending skeletons, so its
+  // collision detector knows about every shape.
+  const auto dartWorld = world->GetDartsimWorld();
+  const auto collisionGroup =
+      dartWorld->getConstraintSolver()->getCollisionGroup();
+  const auto skeleton = dartWorld->getSkeleton("model0");
+  ASSERT_NE(nullptr, skeleton);
+  ASSERT_EQ(5u, skeleton->getNumBodyNodes());
+  for (std::size_t i = 0; i < skeleton->getNumBodyNodes(); ++i)
+  {
+    const auto *bn = skeleton->getBodyNode(i);
+    ASSERT_EQ(1u, bn->getNumShapeNodes());
+    EXPECT_TRUE(collisionGroup->hasShapeFrame(bn->getShapeNode(0)));
+  }
+
+  // The models keep their indices regardless of their order in dartsim
+  EXPECT_EQ(0u, model0->GetIndex());
+  EXPECT_EQ(1u, model1->GetIndex());
+  EXPECT_EQ("model0", world->GetModel(0)->GetName());
+  EXPECT_EQ("model1", world->GetModel(1)->GetName());
+
+  // Adding to a model again and stepping registers it once more
+  auto link = model1->ConstructEmptyLink("link");
+  link->AttachBoxShape("box", Eigen::Vector3d::Ones());
+
+  ignition::physics::ForwardStep::Output output;
+  ignition::physics::ForwardStep::State state;
+  ignition::physics::ForwardStep::Input input;
+  world->Step(output, state, input);
+
+  EXPECT_TRUE(collisionGroup->hasShapeFrame(
+      dartWorld->getSkeleton("model1")->getBodyNode(0)->getShapeNode(0)));
+  EXPECT_EQ("model0", world->GetModel(0)->GetName());
+  EXPECT_EQ("model1", world->GetModel(1)->GetName());
+}
+
 int main(int argc, char *argv[])
 {
   ::testing::InitGoogleTest(&argc, argv);
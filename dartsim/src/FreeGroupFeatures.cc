@@ -93,12 +93,12 @@ Identity FreeGroupFeatures::GetFreeGroupCanonicalLink(
 FreeGroupFeatures::FreeGroupInfo FreeGroupFeatures::GetCanonicalInfo(
     const Identity &_groupID) const
 {
-  const auto model_it = this->models.idToObject.find(_groupID);
-  if (model_it != this->models.idToObject.end())
+  const ModelInfoPtr *modelInfo = this->models.Find(_groupID);
+  if (modelInfo)
   {
     return FreeGroupInfo{
-      model_it->second->model->getRootBodyNode(),
-      model_it->second->model.get()};
+      (*modelInfo)->model->getRootBodyNode(),
+      (*modelInfo)->model.get()};
   }
 
   return FreeGroupInfo{this->links.at(_groupID)->link, nullptr};
@@ -110,6 +110,8 @@ void FreeGroupFeatures::SetFreeGroupWorldPose(
     const PoseType &_pose)
 {
   const FreeGroupInfo &info = GetCanonicalInfo(_groupID);
+  this->InvalidateFrameDataCache();
+
   if (!info.model)
   {
     static_cast<dart::dynamics::FreeJoint*>(info.link->getParentJoint())
@@ -135,6 +137,8 @@ void FreeGroupFeatures::SetFreeGroupWorldLinearVelocity(
     const Identity &_groupID, const LinearVelocity &_linearVelocity)
 {
   const FreeGroupInfo &info = GetCanonicalInfo(_groupID);
+  this->InvalidateFrameDataCache();
+
   if (!info.model)
   {
     static_cast<dart::dynamics::FreeJoint*>(info.link->getParentJoint())
@@ -160,6 +164,8 @@ void FreeGroupFeatures::SetFreeGroupWorldAngularVelocity(
     const Identity &_groupID, const AngularVelocity &_angularVelocity)
 {
   const FreeGroupInfo &info = GetCanonicalInfo(_groupID);
+  this->InvalidateFrameDataCache();
+
   if (!info.model)
   {
     static_cast<dart::dynamics::FreeJoint*>(info.link->getParentJoint())
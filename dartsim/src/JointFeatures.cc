@@ -16,18 +16,111 @@
 */
 
 #include <dart/dynamics/BodyNode.hpp>
+#include <dart/dynamics/DegreeOfFreedom.hpp>
 #include <dart/dynamics/Joint.hpp>
 #include <dart/dynamics/FreeJoint.hpp>
 #include <dart/dynamics/PrismaticJoint.hpp>
 #include <dart/dynamics/RevoluteJoint.hpp>
 #include <dart/dynamics/WeldJoint.hpp>
 
+#include <vector>
+
 #include "JointFeatures.hh"
 
 namespace ignition {
 namespace physics {
 namespace dartsim {
 
+namespace {
+/////////////////////////////////////////////////
+/// \brief Resize a batch output array if it was requested by the caller. This
+/// does not allocate when the array already has the right size.
+void ResizeBatch(std::vector<double> *_output, const std::size_t _size)
+{
+  if (_output)
+    _output->resize(_size);
+}
+
+/////////////////////////////////////////////////
+/// \brief Copy the requested generalized quantities of a skeleton into the
+/// batch arrays, starting at _offset. The arrays must already be large enough.
+void CopySkeletonState(
+    const dart::dynamics::Skeleton &_skel,
+    const std::size_t _offset,
+    std::vector<double> *_positions,
+    std::vector<double> *_velocities,
+    std::vector<double> *_accelerations,
+    std::vector<double> *_forces)
+{
+  const auto numDofs = static_cast<Eigen::Index>(_skel.getNumDofs());
+  if (numDofs == 0)
+    return;
+
+  if (_positions)
+  {
+    Eigen::VectorXd::Map(_positions->data() + _offset, numDofs) =
+        _skel.getPositions();
+  }
+
+  if (_velocities)
+  {
+    Eigen::VectorXd::Map(_velocities->data() + _offset, numDofs) =
+        _skel.getVelocities();
+  }
+
+  if (_accelerations)
+  {
+    Eigen::VectorXd::Map(_accelerations->data() + _offset, numDofs) =
+        _skel.getAccelerations();
+  }
+
+  if (_forces)
+  {
+    Eigen::VectorXd::Map(_forces->data() + _offset, numDofs) =
+        _skel.getForces();
+  }
+}
+
+/////////////////////////////////////////////////
+/// \brief Check that a DOF index map and its buffer of values have matching
+/// sizes. The individual indices are checked by CheckBatchDofs.
+bool CheckBatchSizes(
+    const dart::dynamics::Skeleton &_skel,
+    const std::vector<std::size_t> &_dofs,
+    const std::vector<double> &_values)
+{
+  if (_dofs.size() == _values.size())
+    return true;
+
+  ignerr << "Given [" << _values.size() << "] values for [" << _dofs.size()
+         << "] degrees of freedom of model [" << _skel.getName() << "]. The "
+         << "values will be ignored.\n";
+  return false;
+}
+
+/////////////////////////////////////////////////
+/// \brief Check that every degree of freedom of a batch belongs to the model,
+/// so that the batch can be rejected before any of its values are written.
+bool CheckBatchDofs(
+    const dart::dynamics::Skeleton &_skel,
+    const std::vector<std::size_t> &_dofs)
+{
+  const std::size_t numDofs = _skel.getNumDofs();
+  for (const std::size_t dof : _dofs)
+  {
+    if (dof < numDofs)
+      continue;
+
+    ignerr << "Degree of freedom [" << dof << "] is out of range for model ["
+           << _skel.getName() << "], which has [" << numDofs << "] degrees of "
+           << "freedom. The values will be ignored.\n";
+    return false;
+  }
+
+  return true;
+}
+}
+
 /////////////////////////////////////////////////
 double JointFeatures::GetJointPosition(
     const Identity &_id, const std::size_t _dof) const
@@ -68,6 +161,7 @@ void JointFeatures::SetJointPosition(
     const Identity &_id, const std::size_t _dof, const double _value)
 {
   this->ReferenceInterface<JointInfo>(_id)->joint->setPosition(_dof, _value);
+  this->InvalidateFrameDataCache();
 }
 
 /////////////////////////////////////////////////
@@ -75,6 +169,7 @@ void JointFeatures::SetJointVelocity(
     const Identity &_id, const std::size_t _dof, const double _value)
 {
   this->ReferenceInterface<JointInfo>(_id)->joint->setVelocity(_dof, _value);
+  this->InvalidateFrameDataCache();
 }
 
 /////////////////////////////////////////////////
@@ -83,6 +178,7 @@ void JointFeatures::SetJointAcceleration(
 {
   this->ReferenceInterface<JointInfo>(_id)->joint->setAcceleration(_dof,
                                                                    _value);
+  this->InvalidateFrameDataCache();
 }
 
 /////////////////////////////////////////////////
@@ -130,6 +226,7 @@ void JointFeatures::SetJointTransformFromParent(
 {
   this->ReferenceInterface<JointInfo>(_id)
       ->joint->setTransformFromParentBodyNode(_pose);
+  this->InvalidateFrameDataCache();
 }
 
 /////////////////////////////////////////////////
@@ -138,6 +235,7 @@ void JointFeatures::SetJointTransformToChild(
 {
   this->ReferenceInterface<JointInfo>(_id)
       ->joint->setTransformFromChildBodyNode(_pose.inverse());
+  this->InvalidateFrameDataCache();
 }
 
 /////////////////////////////////////////////////
@@ -170,6 +268,7 @@ Identity JointFeatures::AttachFixedJoint(
 
   const std::size_t jointID = this->AddJoint(
       bn->moveTo<dart::dynamics::WeldJoint>(parentBn, properties));
+  this->InvalidateFrameDataCache();
   return this->GenerateIdentity(jointID, this->joints.at(jointID));
 }
 
@@ -194,6 +293,7 @@ void JointFeatures::SetFreeJointRelativeTransform(
   static_cast<dart::dynamics::FreeJoint *>(
       this->ReferenceInterface<JointInfo>(_jointID)->joint.get())
       ->setRelativeTransform(_pose);
+  this->InvalidateFrameDataCache();
 }
 
 /////////////////////////////////////////////////
@@ -225,6 +325,7 @@ void JointFeatures::SetRevoluteJointAxis(
   static_cast<dart::dynamics::RevoluteJoint *>(
       this->ReferenceInterface<JointInfo>(_jointID)->joint.get())
       ->setAxis(_axis);
+  this->InvalidateFrameDataCache();
 }
 
 /////////////////////////////////////////////////
@@ -245,6 +346,7 @@ Identity JointFeatures::AttachRevoluteJoint(
 
   const std::size_t jointID = this->AddJoint(
       bn->moveTo<dart::dynamics::RevoluteJoint>(parentBn, properties));
+  this->InvalidateFrameDataCache();
   return this->GenerateIdentity(jointID, this->joints.at(jointID));
 }
 
@@ -277,6 +379,7 @@ void JointFeatures::SetPrismaticJointAxis(
   static_cast<dart::dynamics::PrismaticJoint *>(
       this->ReferenceInterface<JointInfo>(_jointID)->joint.get())
       ->setAxis(_axis);
+  this->InvalidateFrameDataCache();
 }
 
 /////////////////////////////////////////////////
@@ -297,9 +400,158 @@ Identity JointFeatures::AttachPrismaticJoint(
 
   const std::size_t jointID = this->AddJoint(
       bn->moveTo<dart::dynamics::PrismaticJoint>(parentBn, properties));
+  this->InvalidateFrameDataCache();
   return this->GenerateIdentity(jointID, this->joints.at(jointID));
 }
 
+/////////////////////////////////////////////////
+std::size_t JointFeatures::GetModelDegreesOfFreedom(
+    const Identity &_modelID) const
+{
+  return this->ReferenceInterface<ModelInfo>(_modelID)->model->getNumDofs();
+}
+
+/////////////////////////////////////////////////
+void JointFeatures::GetModelJointState(
+    const Identity &_modelID,
+    std::vector<double> *_positions,
+    std::vector<double> *_velocities,
+    std::vector<double> *_accelerations,
+    std::vector<double> *_forces) const
+{
+  const auto &skel = *this->ReferenceInterface<ModelInfo>(_modelID)->model;
+  const std::size_t numDofs = skel.getNumDofs();
+
+  ResizeBatch(_positions, numDofs);
+  ResizeBatch(_velocities, numDofs);
+  ResizeBatch(_accelerations, numDofs);
+  ResizeBatch(_forces, numDofs);
+
+  CopySkeletonState(
+        skel, 0, _positions, _velocities, _accelerations, _forces);
+}
+
+/////////////////////////////////////////////////
+std::size_t JointFeatures::GetWorldDegreesOfFreedom(
+    const Identity &_worldID) const
+{
+  std::size_t numDofs = 0;
+  for (std::size_t i = 0; i < this->models.ContainerSize(_worldID); ++i)
+  {
+    numDofs += this->models.at(this->models.IdInContainer(_worldID, i))
+        ->model->getNumDofs();
+  }
+
+  return numDofs;
+}
+
+/////////////////////////////////////////////////
+void JointFeatures::GetWorldJointState(
+    const Identity &_worldID,
+    std::vector<double> *_positions,
+    std::vector<double> *_velocities,
+    std::vector<double> *_accelerations,
+    std::vector<double> *_forces) const
+{
+  const std::size_t numDofs = this->GetWorldDegreesOfFreedom(_worldID);
+
+  ResizeBatch(_positions, numDofs);
+  ResizeBatch(_velocities, numDofs);
+  ResizeBatch(_accelerations, numDofs);
+  ResizeBatch(_forces, numDofs);
+
+  // The models are laid out in the same order as their indices in the world
+  std::size_t offset = 0;
+  for (std::size_t i = 0; i < this->models.ContainerSize(_worldID); ++i)
+  {
+    const auto &skel =
+        *this->models.at(this->models.IdInContainer(_worldID, i))->model;
+    CopySkeletonState(
+          skel, offset, _positions, _velocities, _accelerations, _forces);
+    offset += skel.getNumDofs();
+  }
+}
+
+/////////////////////////////////////////////////
+std::size_t JointFeatures::GetJointDofIndexInModel(
+    const Identity &_jointID, const std::size_t _dof) const
+{
+  return this->ReferenceInterface<JointInfo>(_jointID)
+      ->joint->getIndexInSkeleton(_dof);
+}
+
+/////////////////////////////////////////////////
+void JointFeatures::SetModelJointPositions(
+    const Identity &_modelID,
+    const std::vector<std::size_t> &_dofs,
+    const std::vector<double> &_values)
+{
+  auto &skel = *this->ReferenceInterface<ModelInfo>(_modelID)->model;
+  if (!CheckBatchSizes(skel, _dofs, _values) || !CheckBatchDofs(skel, _dofs))
+    return;
+
+  for (std::size_t i = 0; i < _dofs.size(); ++i)
+    skel.setPosition(_dofs[i], _values[i]);
+
+  this->InvalidateFrameDataCache();
+}
+
+/////////////////////////////////////////////////
+void JointFeatures::SetModelJointVelocities(
+    const Identity &_modelID,
+    const std::vector<std::size_t> &_dofs,
+    const std::vector<double> &_values)
+{
+  auto &skel = *this->ReferenceInterface<ModelInfo>(_modelID)->model;
+  if (!CheckBatchSizes(skel, _dofs, _values) || !CheckBatchDofs(skel, _dofs))
+    return;
+
+  for (std::size_t i = 0; i < _dofs.size(); ++i)
+    skel.setVelocity(_dofs[i], _values[i]);
+
+  this->InvalidateFrameDataCache();
+}
+
+/////////////////////////////////////////////////
+void JointFeatures::SetModelJointForces(
+    const Identity &_modelID,
+    const std::vector<std::size_t> &_dofs,
+    const std::vector<double> &_values)
+{
+  auto &skel = *this->ReferenceInterface<ModelInfo>(_modelID)->model;
+  if (!CheckBatchSizes(skel, _dofs, _values) || !CheckBatchDofs(skel, _dofs))
+    return;
+
+  for (std::size_t i = 0; i < _dofs.size(); ++i)
+    skel.setForce(_dofs[i], _values[i]);
+}
+
+/////////////////////////////////////////////////
+void JointFeatures::SetModelJointVelocityCommands(
+    const Identity &_modelID,
+    const std::vector<std::size_t> &_dofs,
+    const std::vector<double> &_values)
+{
+  auto &skel = *this->ReferenceInterface<ModelInfo>(_modelID)->model;
+  if (!CheckBatchSizes(skel, _dofs, _values) || !CheckBatchDofs(skel, _dofs))
+    return;
+
+  // Consecutive coordinates usually belong to the same joint, so we only look
+  // at the actuator type when the joint changes.
+  const dart::dynamics::Joint *lastJoint = nullptr;
+  for (std::size_t i = 0; i < _dofs.size(); ++i)
+  {
+    dart::dynamics::Joint *joint = skel.getDof(_dofs[i])->getJoint();
+    if (joint != lastJoint)
+    {
+      if (joint->getActuatorType() != dart::dynamics::Joint::SERVO)
+        joint->setActuatorType(dart::dynamics::Joint::SERVO);
+      lastJoint = joint;
+    }
+
+    skel.setCommand(_dofs[i], _values[i]);
+  }
+}
 }
 }
 }
@@ -19,7 +19,9 @@
 #define IGNITION_PHYSICS_DARTSIM_SRC_JOINTFEATURES_HH_
 
 #include <string>
+#include <vector>
 
+#include <ignition/physics/BatchJointState.hh>
 #include <ignition/physics/Joint.hh>
 #include <ignition/physics/FixedJoint.hh>
 #include <ignition/physics/FreeJoint.hh>
@@ -51,7 +53,10 @@ struct JointFeatureList : FeatureList<
   GetPrismaticJointProperties,
   AttachPrismaticJointFeature,
 
-  SetJointVelocityCommandFeature
+  SetJointVelocityCommandFeature,
+
+  GetBatchJointState,
+  SetBatchJointState
 > { };
 
 class JointFeatures :
@@ -166,6 +171,50 @@ class JointFeatures :
   public: void SetJointVelocityCommand(
       const Identity &_id, const std::size_t _dof,
       const double _value) override;
+
+  // ----- Batch Joint State -----
+  public: std::size_t GetModelDegreesOfFreedom(
+      const Identity &_modelID) const override;
+
+  public: void GetModelJointState(
+      const Identity &_modelID,
+      std::vector<double> *_positions,
+      std::vector<double> *_velocities,
+      std::vector<double> *_accelerations,
+      std::vector<double> *_forces) const override;
+
+  public: std::size_t GetWorldDegreesOfFreedom(
+      const Identity &_worldID) const override;
+
+  public: void GetWorldJointState(
+      const Identity &_worldID,
+      std::vector<double> *_positions,
+      std::vector<double> *_velocities,
+      std::vector<double> *_accelerations,
+      std::vector<double> *_forces) const override;
+
+  public: std::size_t GetJointDofIndexInModel(
+      const Identity &_jointID, const std::size_t _dof) const override;
+
+  public: void SetModelJointPositions(
+      const Identity &_modelID,
+      const std::vector<std::size_t> &_dofs,
+      const std::vector<double> &_values) override;
+
+  public: void SetModelJointVelocities(
+      const Identity &_modelID,
+      const std::vector<std::size_t> &_dofs,
+      const std::vector<double> &_values) override;
+
+  public: void SetModelJointForces(
+      const Identity &_modelID,
+      const std::vector<std::size_t> &_dofs,
+      const std::vector<double> &_values) override;
+
+  public: void SetModelJointVelocityCommands(
+      const Identity &_modelID,
+      const std::vector<std::size_t> &_dofs,
+      const std::vector<double> &_values) override;
 };
 
 }
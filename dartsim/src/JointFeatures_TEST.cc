@@ -21,6 +21,7 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <vector>
 
 #include <ignition/physics/FindFeatures.hh>
 #include <ignition/plugin/Loader.hh>
@@ -29,7 +30,9 @@
 #include <ignition/math/eigen3/Conversions.hh>
 
 // Features
+#include <ignition/physics/BatchJointState.hh>
 #include <ignition/physics/ForwardStep.hh>
+#include <ignition/physics/FrameSemantics.hh>
 #include <ignition/physics/GetEntities.hh>
 #include <ignition/physics/Joint.hh>
 #include <ignition/physics/RevoluteJoint.hh>
@@ -46,8 +49,14 @@ using namespace ignition;
 using TestFeatureList = ignition::physics::FeatureList<
   physics::dartsim::RetrieveWorld,
   physics::ForwardStep,
+  physics::FrameDataCache,
+  physics::GetBasicJointProperties,
   physics::GetBasicJointState,
+  physics::GetBatchJointState,
   physics::GetEntities,
+  physics::LinkFrameSemantics,
+  physics::SetBasicJointState,
+  physics::SetBatchJointState,
   physics::SetJointVelocityCommandFeature,
   physics::sdf::ConstructSdfWorld
 >;
@@ -130,6 +139,336 @@ TEST_F(JointFeaturesFixture, JointSetCommand)
   }
 }
 
+// Test that the batch joint state of models and worlds matches the state
+// reported by each individual joint
+TEST_F(JointFeaturesFixture, GetBatchJointState)
+{
+  sdf::Root root;
+  const sdf::Errors errors = root.Load(TEST_WORLD_DIR "test.world");
+  ASSERT_TRUE(errors.empty()) << errors.front();
+
+  auto world = this->engine->ConstructWorld(*root.WorldByIndex(0));
+
+  physics::ForwardStep::Output output;
+  physics::ForwardStep::State state;
+  physics::ForwardStep::Input input;
+
+  for (std::size_t i = 0; i < 10; ++i)
+    world->Step(output, state, input);
+
+  std::vector<double> worldPositions;
+  std::vector<double> worldForces;
+  world->GetJointState(&worldPositions, nullptr, nullptr, &worldForces);
+  ASSERT_EQ(world->GetDegreesOfFreedom(), worldPositions.size());
+  ASSERT_EQ(worldPositions.size(), worldForces.size());
+
+  std::vector<double> positions;
+  std::vector<double> velocities;
+  std::vector<double> accelerations;
+  std::vector<double> forces;
+
+  std::size_t worldOffset = 0;
+  for (std::size_t m = 0; m < world->GetModelCount(); ++m)
+  {
+    auto model = world->GetModel(m);
+    model->GetJointState(&positions, &velocities, &accelerations, &forces);
+
+    const std::size_t numDofs = model->GetDegreesOfFreedom();
+    ASSERT_EQ(numDofs, positions.size());
+    ASSERT_EQ(numDofs, velocities.size());
+    ASSERT_EQ(numDofs, accelerations.size());
+    ASSERT_EQ(numDofs, forces.size());
+
+    for (std::size_t j = 0; j < model->GetJointCount(); ++j)
+    {
+      auto joint = model->GetJoint(j);
+      for (std::size_t dof = 0; dof < joint->GetDegreesOfFreedom(); ++dof)
+      {
+        const std::size_t index = joint->GetDofIndexInModel(dof);
+        ASSERT_LT(index, numDofs);
+        EXPECT_DOUBLE_EQ(joint->GetPosition(dof), positions[index]);
+        EXPECT_DOUBLE_EQ(joint->GetVelocity(dof), velocities[index]);
+        EXPECT_DOUBLE_EQ(joint->GetAcceleration(dof), accelerations[index]);
+        EXPECT_DOUBLE_EQ(joint->GetForce(dof), forces[index]);
+
+        EXPECT_DOUBLE_EQ(positions[index], worldPositions[worldOffset + index]);
+        EXPECT_DOUBLE_EQ(forces[index], worldForces[worldOffset + index]);
+      }
+    }
+
+    worldOffset += numDofs;
+  }
+
+  EXPECT_EQ(worldPositions.size(), worldOffset);
+}
+
+// Test setting the state and velocity commands of several joints at once
+TEST_F(JointFeaturesFixture, SetBatchJointState)
+{
+  sdf::Root root;
+  const sdf::Errors errors = root.Load(TEST_WORLD_DIR "test.world");
+  ASSERT_TRUE(errors.empty()) << errors.front();
+
+  const std::string modelName{"double_pendulum_with_base"};
+
+  auto world = this->engine->ConstructWorld(*root.WorldByIndex(0));
+  auto model = world->GetModel(modelName);
+  auto upperJoint = model->GetJoint("upper_joint");
+  auto lowerJoint = model->GetJoint("lower_joint");
+
+  // Build the index map once
+  const std::vector<std::size_t> dofs = {
+    upperJoint->GetDofIndexInModel(0),
+    lowerJoint->GetDofIndexInModel(0)};
+
+  model->SetJointPositions(dofs, {0.5, -0.3});
+  EXPECT_DOUBLE_EQ(0.5, upperJoint->GetPosition(0));
+  EXPECT_DOUBLE_EQ(-0.3, lowerJoint->GetPosition(0));
+
+  model->SetJointVelocities(dofs, {0.1, 0.2});
+  EXPECT_DOUBLE_EQ(0.1, upperJoint->GetVelocity(0));
+  EXPECT_DOUBLE_EQ(0.2, lowerJoint->GetVelocity(0));
+
+  // A buffer whose size does not match the index map is ignored
+  model->SetJointPositions(dofs, {1.0});
+  EXPECT_DOUBLE_EQ(0.5, upperJoint->GetPosition(0));
+  EXPECT_DOUBLE_EQ(-0.3, lowerJoint->GetPosition(0));
+
+  // A batch with an index outside of the model is ignored as a whole, even
+  // the values of its valid indices
+  model->SetJointPositions({dofs[0], 1000}, {1.0, 1.0});
+  EXPECT_DOUBLE_EQ(0.5, upperJoint->GetPosition(0));
+  model->SetJointVelocities({dofs[0], 1000}, {1.0, 1.0});
+  EXPECT_DOUBLE_EQ(0.1, upperJoint->GetVelocity(0));
+
+  dart::simulation::WorldPtr dartWorld = world->GetDartsimWorld();
+  const dart::dynamics::SkeletonPtr skeleton =
+      dartWorld->getSkeleton(modelName);
+  ASSERT_NE(nullptr, skeleton);
+
+  physics::ForwardStep::Output output;
+  physics::ForwardStep::State state;
+  physics::ForwardStep::Input input;
+
+  const std::vector<double> commands = {1.0, -1.0};
+  for (std::size_t i = 0; i < 10; ++i)
+  {
+    model->SetJointVelocityCommands(dofs, commands);
+    world->Step(output, state, input);
+    EXPECT_NEAR(1.0, upperJoint->GetVelocity(0), 1e-6);
+    EXPECT_NEAR(-1.0, lowerJoint->GetVelocity(0), 1e-6);
+  }
+
+  EXPECT_EQ(dart::dynamics::Joint::SERVO,
+            skeleton->getJoint("upper_joint")->getActuatorType());
+  EXPECT_EQ(dart::dynamics::Joint::SERVO,
+            skeleton->getJoint("lower_joint")->getActuatorType());
+}
+
+// Test that cached frame data is reused until the state of the world changes
+TEST_F(JointFeaturesFixture, FrameDataCache)
+{
+  sdf::Root root;
+  const sdf::Errors errors = root.Load(TEST_WORLD_DIR "test.world");
+  ASSERT_TRUE(errors.empty()) << errors.front();
+
+  auto world = this->engine->ConstructWorld(*root.WorldByIndex(0));
+  auto model = world->GetModel("double_pendulum_with_base");
+  auto joint = model->GetJoint("upper_joint");
+  auto link = model->GetLink("lower_link");
+
+  EXPECT_FALSE(this->engine->GetFrameDataCacheEnabled());
+  this->engine->SetFrameDataCacheEnabled(true);
+  EXPECT_TRUE(this->engine->GetFrameDataCacheEnabled());
+
+  const auto &dartJoint = world->GetDartsimWorld()
+      ->getSkeleton("double_pendulum_with_base")->getJoint("upper_joint");
+
+  const Eigen::Vector3d initialPosition =
+      link->FrameDataRelativeToWorld().pose.translation();
+
+  // Changing the state behind the back of the plugin does not update the
+  // cached data until the cache is invalidated
+  dartJoint->setPosition(0, 1.0);
+  EXPECT_EQ(initialPosition,
+            link->FrameDataRelativeToWorld().pose.translation());
+
+  this->engine->InvalidateFrameDataCache();
+  const Eigen::Vector3d movedPosition =
+      link->FrameDataRelativeToWorld().pose.translation();
+  EXPECT_NE(initialPosition, movedPosition);
+
+  // Setting the state through the plugin invalidates the cache
+  joint->SetPosition(0, 0.0);
+  EXPECT_EQ(initialPosition,
+            link->FrameDataRelativeToWorld().pose.translation());
+
+  joint->SetVelocity(0, 1.0);
+  EXPECT_LT(0.0, link->FrameDataRelativeToWorld().linearVelocity.norm());
+
+  // So does stepping the world
+  physics::ForwardStep::Output output;
+  physics::ForwardStep::State state;
+  physics::ForwardStep::Input input;
+  for (std::size_t i = 0; i < 10; ++i)
+    world->Step(output, state, input);
+
+  const auto frameData = link->FrameDataRelativeToWorld();
+  EXPECT_NE(initialPosition, frameData.pose.translation());
+
+  this->engine->SetFrameDataCacheEnabled(false);
+  const auto uncachedData = link->FrameDataRelativeToWorld();
+  EXPECT_TRUE(frameData.pose.isApprox(uncachedData.pose));
+  EXPECT_EQ(frameData.linearVelocity, uncachedData.linearVelocity);
+  EXPECT_EQ(frameData.angularVelocity, uncachedData.angularVelocity);
+}
+
+// Test that the commands of a step input are applied during that step
+TEST_F(JointFeaturesFixture, StepInput)
+{
+  sdf::Root root;
+  const sdf::Errors errors = root.Load(TEST_WORLD_DIR "test.world");
+  ASSERT_TRUE(errors.empty()) << errors.front();
+
+  const std::string modelName{"double_pendulum_with_base"};
+
+  // Each input is compared against a reference world which steps without it
+  auto world = this->engine->ConstructWorld(*root.WorldByIndex(0));
+  auto reference = this->engine->ConstructWorld(*root.WorldByIndex(0));
+
+  auto model = world->GetModel(modelName);
+  auto upperJoint = model->GetJoint("upper_joint");
+  auto lowerJoint = model->GetJoint("lower_joint");
+  auto lowerLink = model->GetLink("lower_link");
+
+  auto referenceModel = reference->GetModel(modelName);
+  auto referenceUpperJoint = referenceModel->GetJoint("upper_joint");
+  auto referenceLowerLink = referenceModel->GetLink("lower_link");
+
+  physics::ForwardStep::Output output;
+  physics::ForwardStep::State state;
+  physics::ForwardStep::State referenceState;
+  physics::ForwardStep::Input input;
+  physics::ForwardStep::Input noInput;
+
+  // A generalized force speeds the joint up in its direction
+  input.Get<physics::ApplyGeneralizedForces>().forces.push_back(
+      {{upperJoint->EntityID()}, {100.0}, ""});
+  world->Step(output, state, input);
+  reference->Step(output, referenceState, noInput);
+  EXPECT_LT(referenceUpperJoint->GetVelocity(0), upperJoint->GetVelocity(0));
+  input.Clear();
+
+  // A servo pulls the joint towards its target position
+  const double target = upperJoint->GetPosition(0) - 1.0;
+  input.Get<physics::ServoControlCommands>().commands.push_back(
+      {{upperJoint->EntityID()}, {target}, ""});
+  input.Get<physics::ServoControlCommands>().gains.push_back({100.0, 0, 0});
+  const double velocityBefore = upperJoint->GetVelocity(0);
+  const double referenceVelocityBefore = referenceUpperJoint->GetVelocity(0);
+  world->Step(output, state, input);
+  reference->Step(output, referenceState, noInput);
+  EXPECT_GT(referenceUpperJoint->GetVelocity(0) - referenceVelocityBefore,
+            upperJoint->GetVelocity(0) - velocityBefore);
+  input.Clear();
+
+  // An external force accelerates the link in its direction
+  const Eigen::Vector3d force(0.0, 100.0, 100.0);
+  physics::ForceTorque wrench;
+  wrench.body = lowerLink->EntityID();
+  wrench.location.point = math::Vector3d::Zero;
+  wrench.location.relativeTo = lowerLink->EntityID();
+  wrench.location.inCoordinatesOf = physics::FrameID::World().ID();
+  wrench.force.vec = math::eigen3::convert(force);
+  wrench.force.inCoordinatesOf = physics::FrameID::World().ID();
+  wrench.torque.vec = math::Vector3d::Zero;
+  wrench.torque.inCoordinatesOf = physics::FrameID::World().ID();
+  input.Get<physics::ApplyExternalForceTorques>().entries.push_back(wrench);
+
+  const Eigen::Vector3d linkVelocityBefore =
+      lowerLink->FrameDataRelativeToWorld().linearVelocity;
+  const Eigen::Vector3d referenceLinkVelocityBefore =
+      referenceLowerLink->FrameDataRelativeToWorld().linearVelocity;
+  world->Step(output, state, input);
+  reference->Step(output, referenceState, noInput);
+  const Eigen::Vector3d change =
+      lowerLink->FrameDataRelativeToWorld().linearVelocity
+      - linkVelocityBefore;
+  const Eigen::Vector3d referenceChange =
+      referenceLowerLink->FrameDataRelativeToWorld().linearVelocity
+      - referenceLinkVelocityBefore;
+  EXPECT_LT(0.0, (change - referenceChange).dot(force));
+  input.Clear();
+
+  // Velocity commands are reached within the step
+  input.Get<physics::VelocityControlCommands>().commands.push_back(
+      {{upperJoint->EntityID(), lowerJoint->EntityID()}, {1.0, -1.0}, ""});
+  for (std::size_t i = 0; i < 10; ++i)
+  {
+    world->Step(output, state, input);
+    EXPECT_NEAR(1.0, upperJoint->GetVelocity(0), 1e-6);
+    EXPECT_NEAR(-1.0, lowerJoint->GetVelocity(0), 1e-6);
+  }
+}
+
+// Test that the inputs of a step cannot reach the entities of another world
+TEST_F(JointFeaturesFixture, StepInputOfOtherWorld)
+{
+  sdf::Root root;
+  const sdf::Errors errors = root.Load(TEST_WORLD_DIR "test.world");
+  ASSERT_TRUE(errors.empty()) << errors.front();
+
+  const std::string modelName{"double_pendulum_with_base"};
+
+  auto world = this->engine->ConstructWorld(*root.WorldByIndex(0));
+  auto otherWorld = this->engine->ConstructWorld(*root.WorldByIndex(0));
+
+  auto otherModel = otherWorld->GetModel(modelName);
+  auto otherJoint = otherModel->GetJoint("upper_joint");
+  auto otherLink = otherModel->GetLink("lower_link");
+
+  // Every input of the step names an entity of the other world
+  physics::ForwardStep::Input input;
+  input.Get<physics::ApplyGeneralizedForces>().forces.push_back(
+      {{otherJoint->EntityID()}, {100.0}, ""});
+  input.Get<physics::VelocityControlCommands>().commands.push_back(
+      {{otherJoint->EntityID()}, {1.0}, ""});
+  input.Get<physics::ServoControlCommands>().commands.push_back(
+      {{otherJoint->EntityID()}, {1.0}, ""});
+  input.Get<physics::ServoControlCommands>().gains.push_back({100.0, 0, 0});
+
+  physics::ForceTorque wrench;
+  wrench.body = otherLink->EntityID();
+  wrench.location.point = math::Vector3d::Zero;
+  wrench.location.relativeTo = otherLink->EntityID();
+  wrench.location.inCoordinatesOf = physics::FrameID::World().ID();
+  wrench.force.vec = math::Vector3d(0.0, 100.0, 100.0);
+  wrench.force.inCoordinatesOf = physics::FrameID::World().ID();
+  wrench.torque.vec = math::Vector3d(100.0, 0.0, 0.0);
+  wrench.torque.inCoordinatesOf = physics::FrameID::World().ID();
+  input.Get<physics::ApplyExternalForceTorques>().entries.push_back(wrench);
+
+  physics::ForwardStep::Output output;
+  physics::ForwardStep::State state;
+  world->Step(output, state, input);
+
+  dart::simulation::WorldPtr otherDartWorld = otherWorld->GetDartsimWorld();
+  ASSERT_NE(nullptr, otherDartWorld);
+  const dart::dynamics::SkeletonPtr otherSkeleton =
+      otherDartWorld->getSkeleton(modelName);
+  ASSERT_NE(nullptr, otherSkeleton);
+
+  const dart::dynamics::Joint *otherDartJoint =
+      otherSkeleton->getJoint("upper_joint");
+  EXPECT_DOUBLE_EQ(0.0, otherDartJoint->getForce(0));
+  EXPECT_DOUBLE_EQ(0.0, otherDartJoint->getCommand(0));
+  EXPECT_NE(dart::dynamics::Joint::SERVO, otherDartJoint->getActuatorType());
+
+  const dart::dynamics::BodyNode *otherBody =
+      otherSkeleton->getBodyNode("lower_link");
+  EXPECT_TRUE(otherBody->getExternalForceLocal().isZero());
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char *argv[])
 {
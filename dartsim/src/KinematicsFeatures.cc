@@ -27,6 +27,13 @@ namespace dartsim {
 /////////////////////////////////////////////////
 FrameData3d KinematicsFeatures::FrameDataRelativeToWorld(
     const FrameID &_id) const
+{
+  return this->PartialFrameDataRelativeToWorld(_id, FrameDataMask::ALL);
+}
+
+/////////////////////////////////////////////////
+FrameData3d KinematicsFeatures::PartialFrameDataRelativeToWorld(
+    const FrameID &_id, unsigned int _mask) const
 {
   FrameData3d data;
 
@@ -39,27 +46,78 @@ FrameData3d KinematicsFeatures::FrameDataRelativeToWorld(
     return data;
   }
 
+  CachedFrameData *cached = nullptr;
+  std::size_t version = 0;
+  if (this->frameDataCacheEnabled)
+  {
+    version = this->frameDataVersion;
+    cached = &this->frameDataCache[_id.ID()];
+    if (cached->version == version)
+      return cached->data;
+
+    // Cached entries always hold every field, so that they can serve any
+    // later request.
+    _mask = FrameDataMask::ALL;
+  }
+
   const dart::dynamics::Frame *frame = SelectFrame(_id);
 
-  data.pose = frame->getWorldTransform();
-  data.linearVelocity = frame->getLinearVelocity();
-  data.angularVelocity = frame->getAngularVelocity();
-  data.linearAcceleration = frame->getLinearAcceleration();
-  data.angularAcceleration = frame->getAngularAcceleration();
+  // Each of these makes DART update the corresponding spatial quantity of the
+  // frame and of its ancestors if they are outdated, which is why we skip the
+  // ones that were not requested.
+  if (_mask & FrameDataMask::POSE)
+    data.pose = frame->getWorldTransform();
+
+  if (_mask & FrameDataMask::LINEAR_VELOCITY)
+    data.linearVelocity = frame->getLinearVelocity();
+
+  if (_mask & FrameDataMask::ANGULAR_VELOCITY)
+    data.angularVelocity = frame->getAngularVelocity();
+
+  if (_mask & FrameDataMask::LINEAR_ACCELERATION)
+    data.linearAcceleration = frame->getLinearAcceleration();
+
+  if (_mask & FrameDataMask::ANGULAR_ACCELERATION)
+    data.angularAcceleration = frame->getAngularAcceleration();
+
+  if (cached)
+    *cached = CachedFrameData{version, data};
 
   return data;
 }
 
+/////////////////////////////////////////////////
+void KinematicsFeatures::SetEngineFrameDataCacheEnabled(
+    const Identity &/*_engineID*/, const bool _enabled)
+{
+  this->frameDataCacheEnabled = _enabled;
+  this->frameDataCache.clear();
+}
+
+/////////////////////////////////////////////////
+bool KinematicsFeatures::GetEngineFrameDataCacheEnabled(
+    const Identity &/*_engineID*/) const
+{
+  return this->frameDataCacheEnabled;
+}
+
+/////////////////////////////////////////////////
+void KinematicsFeatures::InvalidateEngineFrameDataCache(
+    const Identity &/*_engineID*/)
+{
+  this->InvalidateFrameDataCache();
+}
+
 /////////////////////////////////////////////////
 const dart::dynamics::Frame *KinematicsFeatures::SelectFrame(
     const FrameID &_id) const
 {
-  const auto model_it = this->models.idToObject.find(_id.ID());
-  if (model_it != this->models.idToObject.end())
+  const ModelInfoPtr *modelInfo = this->models.Find(_id.ID());
+  if (modelInfo)
   {
     // This is a model FreeGroup frame, so we'll use the first root link as the
     // frame
-    return model_it->second->model->getRootBodyNode();
+    return (*modelInfo)->model->getRootBodyNode();
   }
 
   return this->frames.at(_id.ID());
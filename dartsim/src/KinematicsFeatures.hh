@@ -30,7 +30,8 @@ namespace dartsim {
 struct KinematicsFeatureList : FeatureList<
   LinkFrameSemantics,
   ShapeFrameSemantics,
-  FreeGroupFrameSemantics
+  FreeGroupFrameSemantics,
+  FrameDataCache
 > { };
 
 class KinematicsFeatures :
@@ -39,6 +40,19 @@ class KinematicsFeatures :
 {
   public: FrameData3d FrameDataRelativeToWorld(const FrameID &_id) const;
 
+  public: FrameData3d PartialFrameDataRelativeToWorld(
+      const FrameID &_id, unsigned int _mask) const override;
+
+  // ----- FrameDataCache -----
+  public: void SetEngineFrameDataCacheEnabled(
+      const Identity &_engineID, bool _enabled) override;
+
+  public: bool GetEngineFrameDataCacheEnabled(
+      const Identity &_engineID) const override;
+
+  public: void InvalidateEngineFrameDataCache(
+      const Identity &_engineID) override;
+
   public: const dart::dynamics::Frame *SelectFrame(const FrameID &_id) const;
 };
 
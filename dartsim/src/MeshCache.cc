@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <memory>
+#include <string>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Mesh.hh>
+#include <ignition/common/MeshManager.hh>
+#include <ignition/common/SubMesh.hh>
+#include <ignition/common/Util.hh>
+
+#include "MeshCache.hh"
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+namespace {
+/////////////////////////////////////////////////
+/// \brief Convert a mesh file into a dartsim mesh shape
+/// \return The shape, or a nullptr if the mesh could not be loaded.
+std::shared_ptr<CustomMeshShape> ConvertMesh(
+    const std::string &_path,
+    const Eigen::Vector3d &_scale,
+    const std::string &_submesh,
+    const bool _centerSubmesh)
+{
+  // The mesh manager keeps every mesh that it parsed, so the file itself is
+  // only parsed once even if its shape was released in the meantime.
+  const ignition::common::Mesh *mesh =
+      ignition::common::MeshManager::Instance()->Load(_path);
+  if (!mesh)
+  {
+    ignerr << "[dartsim::MeshCache] Unable to load the mesh file [" << _path
+           << "]\n";
+    return nullptr;
+  }
+
+  if (_submesh.empty())
+    return std::make_shared<CustomMeshShape>(*mesh, _scale);
+
+  const auto subMesh = mesh->SubMeshByName(_submesh).lock();
+  if (!subMesh)
+  {
+    ignerr << "[dartsim::MeshCache] The mesh file [" << _path << "] does "
+           << "not contain a submesh named [" << _submesh << "]\n";
+    return nullptr;
+  }
+
+  ignition::common::Mesh subMeshOnly;
+  subMeshOnly.SetPath(mesh->Path());
+  auto copy = subMeshOnly.AddSubMesh(*subMesh).lock();
+  if (_centerSubmesh)
+    copy->Center(ignition::math::Vector3d::Zero);
+
+  return std::make_shared<CustomMeshShape>(subMeshOnly, _scale);
+}
+}
+
+/////////////////////////////////////////////////
+std::shared_ptr<CustomMeshShape> MeshCache::Load(
+    const std::string &_uri,
+    const Eigen::Vector3d &_scale,
+    const std::string &_submesh,
+    const bool _centerSubmesh)
+{
+  const std::string path = ignition::common::findFile(_uri);
+  if (path.empty())
+  {
+    ignerr << "[dartsim::MeshCache] Unable to find the mesh file [" << _uri
+           << "]\n";
+    return nullptr;
+  }
+
+  const bool centerSubmesh = !_submesh.empty() && _centerSubmesh;
+  const Key key{path, _scale[0], _scale[1], _scale[2], _submesh, centerSubmesh};
+
+  std::promise<std::shared_ptr<CustomMeshShape>> promise;
+  std::shared_future<std::shared_ptr<CustomMeshShape>> loading;
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    Entry &entry = this->shapes[key];
+    if (auto shape = entry.shape.lock())
+      return shape;
+
+    if (entry.loading.valid())
+      loading = entry.loading;
+    else
+      entry.loading = promise.get_future().share();
+  }
+
+  // Another thread is converting the same shape, so we wait for it outside
+  // of the lock.
+  if (loading.valid())
+    return loading.get();
+
+  // Parsing and converting the mesh is the expensive part, so it happens
+  // outside of the lock and other shapes can be loaded at the same time.
+  std::shared_ptr<CustomMeshShape> shape;
+  try
+  {
+    shape = ConvertMesh(path, _scale, _submesh, centerSubmesh);
+  }
+  catch (...)
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->shapes.erase(key);
+    }
+    promise.set_exception(std::current_exception());
+    throw;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    if (shape)
+    {
+      Entry &entry = this->shapes[key];
+      entry.shape = shape;
+      entry.loading = {};
+    }
+    else
+    {
+      this->shapes.erase(key);
+    }
+
+    // Drop the entries of shapes that are no longer used, so that loading
+    // many different meshes over time does not grow the map forever. The
+    // map is only swept once it has doubled in size since the last sweep,
+    // which keeps the cost of sweeping constant per loaded shape. Shapes
+    // that are being converted are kept.
+    if (this->shapes.size() >= 2 * this->sizeAfterSweep)
+    {
+      for (auto it = this->shapes.begin(); it != this->shapes.end();)
+      {
+        if (it->second.shape.expired() && !it->second.loading.valid())
+          it = this->shapes.erase(it);
+        else
+          ++it;
+      }
+
+      this->sizeAfterSweep = std::max(this->shapes.size(), kMinSweepSize);
+    }
+  }
+
+  promise.set_value(shape);
+  return shape;
+}
+
+}
+}
+}
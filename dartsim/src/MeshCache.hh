@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_DARTSIM_SRC_MESHCACHE_HH_
+#define IGNITION_PHYSICS_DARTSIM_SRC_MESHCACHE_HH_
+
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+#include "CustomMeshShape.hh"
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+/// \brief Converts mesh files into dartsim mesh shapes at most once.
+///
+/// Every request for the same file, scale and submesh gets the same shape,
+/// so all the ShapeNodes that use it share its assimp scene and the
+/// collision geometry that the collision detector builds for it. A shape is
+/// released when the last ShapeNode that uses it is removed.
+///
+/// Several threads may load meshes at the same time. Files are parsed and
+/// converted outside of the lock, so only loads of the same shape wait for
+/// each other.
+class MeshCache
+{
+  /// \brief Get the mesh shape of a mesh file, converting the file if no
+  /// ShapeNode currently uses a shape for the same parameters.
+  /// \param[in] _uri
+  ///   URI of the mesh file
+  /// \param[in] _scale
+  ///   Scale of the mesh
+  /// \param[in] _submesh
+  ///   Name of the only submesh to use, or an empty string to use all of them
+  /// \param[in] _centerSubmesh
+  ///   True to center the submesh at the origin of the shape
+  /// \return The shape, or a nullptr if the mesh could not be loaded.
+  public: std::shared_ptr<CustomMeshShape> Load(
+      const std::string &_uri,
+      const Eigen::Vector3d &_scale,
+      const std::string &_submesh = "",
+      bool _centerSubmesh = false);
+
+  /// \brief Identifies a shape: resolved path, scale, submesh name and
+  /// whether the submesh is centered
+  private: using Key =
+      std::tuple<std::string, double, double, double, std::string, bool>;
+
+  /// \brief A shape, or the conversion of a shape that is in progress
+  private: struct Entry
+  {
+    /// \brief The shape, which may have been released since it was converted
+    std::weak_ptr<CustomMeshShape> shape;
+
+    /// \brief Valid while a thread converts the shape, so that other threads
+    /// which need the same shape wait for it instead of converting it again
+    std::shared_future<std::shared_ptr<CustomMeshShape>> loading;
+  };
+
+  /// \brief Shapes that were converted or are being converted
+  private: std::map<Key, Entry> shapes;
+
+  /// \brief The fewest entries that the shapes can have after a sweep, so
+  /// that a small cache is not swept on every load.
+  private: static constexpr std::size_t kMinSweepSize = 16;
+
+  /// \brief Number of shapes after the last sweep of released shapes
+  private: std::size_t sizeAfterSweep = kMinSweepSize;
+
+  /// \brief Protects the shapes and sizeAfterSweep
+  private: mutable std::mutex mutex;
+};
+
+}
+}
+}
+
+#endif  // IGNITION_PHYSICS_DARTSIM_SRC_MESHCACHE_HH_
@@ -32,9 +32,16 @@
 #include <dart/constraint/WeldJointConstraint.hpp>
 #include <dart/dynamics/WeldJoint.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <ignition/common/Console.hh>
+#include <ignition/common/Filesystem.hh>
 #include <ignition/math/eigen3/Conversions.hh>
 #include <ignition/math/Helpers.hh>
 
@@ -282,20 +289,52 @@ static ShapeAndTransform ConstructPlane(
           Eigen::Vector3d(planeDim, planeDim, planeDim)), tf};
 }
 
+/////////////////////////////////////////////////
+/// \brief Resolve the URI of a mesh against the path of the SDF file that it
+/// was loaded from. A relative path is taken relative to the directory of the
+/// file, and a model:// URI is looked up next to the directory of the model
+/// that the file belongs to. Anything else, or a URI that does not resolve to
+/// an existing file, is returned unchanged for common::findFile to search.
+static std::string ResolveMeshUri(
+    const std::string &_uri, const std::string &_filePath)
+{
+  if (_uri.empty() || _filePath.empty())
+    return _uri;
+
+  const std::string modelPrefix = "model://";
+  std::string resolved;
+  if (_uri.compare(0, modelPrefix.size(), modelPrefix) == 0)
+  {
+    resolved = common::joinPaths(
+          common::parentPath(common::parentPath(_filePath)),
+          _uri.substr(modelPrefix.size()));
+  }
+  else if (_uri.find("://") == std::string::npos && _uri.front() != '/'
+           && !(_uri.size() > 1 && _uri[1] == ':'))
+  {
+    resolved = common::joinPaths(common::parentPath(_filePath), _uri);
+  }
+
+  return !resolved.empty() && common::exists(resolved) ? resolved : _uri;
+}
+
 /////////////////////////////////////////////////
 static ShapeAndTransform ConstructMesh(
-    const ::sdf::Mesh & /*_mesh*/)
+    const ::sdf::Mesh &_mesh, MeshCache &_meshCache)
 {
-  // TODO(MXG): Look into what kind of mesh URI we get here. Will it just be
-  // a local file name, or do we need to resolve the URI?
-  ignerr << "Mesh construction from an SDF has not been implemented yet for "
-         << "dartsim.\n";
-  return {nullptr};
+  // Resolve the URI against the SDF file before the cache looks it up, since
+  // common::findFile would look for a relative URI in the working directory.
+  const std::string filePath =
+      _mesh.Element() ? _mesh.Element()->FilePath() : std::string();
+
+  return {_meshCache.Load(ResolveMeshUri(_mesh.Uri(), filePath),
+                          math::eigen3::convert(_mesh.Scale()),
+                          _mesh.Submesh(), _mesh.CenterSubmesh())};
 }
 
 /////////////////////////////////////////////////
 static ShapeAndTransform ConstructGeometry(
-    const ::sdf::Geometry &_geometry)
+    const ::sdf::Geometry &_geometry, MeshCache &_meshCache)
 {
   if (_geometry.BoxShape())
     return ConstructBox(*_geometry.BoxShape());
@@ -306,7 +345,7 @@ static ShapeAndTransform ConstructGeometry(
   else if (_geometry.PlaneShape())
     return ConstructPlane(*_geometry.PlaneShape());
   else if (_geometry.MeshShape())
-    return ConstructMesh(*_geometry.MeshShape());
+    return ConstructMesh(*_geometry.MeshShape(), _meshCache);
 
   return {nullptr};
 }
@@ -327,14 +366,58 @@ Identity SDFFeatures::ConstructSdfWorld(
   // information here. For now, we'll just use dartsim's default physics
   // parameters.
 
-  for (std::size_t i=0; i < _sdfWorld.ModelCount(); ++i)
+  const std::size_t numModels = _sdfWorld.ModelCount();
+  std::size_t numThreads = this->constructWorldThreadCount;
+  if (numThreads == 0)
+    numThreads = std::max(1u, std::thread::hardware_concurrency());
+  numThreads = std::min(numThreads, numModels);
+
+  if (numThreads <= 1)
   {
-    const ::sdf::Model *model = _sdfWorld.ModelByIndex(i);
+    for (std::size_t i=0; i < numModels; ++i)
+    {
+      const ::sdf::Model *model = _sdfWorld.ModelByIndex(i);
 
-    if (!model)
-      continue;
+      if (!model)
+        continue;
+
+      this->ConstructSdfModel(worldID, *model);
+    }
 
-    this->ConstructSdfModel(worldID, *model);
+    return worldID;
+  }
+
+  // Each thread, including the calling one, keeps picking the next model that
+  // has not been built yet until there are none left. Building a model does
+  // not touch the world or the entity storages, so the models are added to
+  // them afterwards, in order, which gives every entity the same ID that it
+  // would get from a serial construction.
+  std::vector<SdfModelBuild> builds(numModels);
+  std::atomic<std::size_t> nextModel{0};
+  auto buildRemainingModels = [&]()
+  {
+    for (std::size_t i = nextModel++; i < numModels; i = nextModel++)
+    {
+      const ::sdf::Model *model = _sdfWorld.ModelByIndex(i);
+      if (model)
+        builds[i] = this->BuildSdfModel(*model);
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(numThreads - 1);
+  for (std::size_t i = 1; i < numThreads; ++i)
+    workers.emplace_back(buildRemainingModels);
+
+  buildRemainingModels();
+
+  for (auto &worker : workers)
+    worker.join();
+
+  for (const SdfModelBuild &build : builds)
+  {
+    if (build.info.model)
+      this->AddSdfModel(worldID, build);
   }
 
   return worldID;
@@ -344,31 +427,37 @@ Identity SDFFeatures::ConstructSdfWorld(
 Identity SDFFeatures::ConstructSdfModel(
     const Identity &_worldID,
     const ::sdf::Model &_sdfModel)
+{
+  return this->AddSdfModel(_worldID, this->BuildSdfModel(_sdfModel));
+}
+
+/////////////////////////////////////////////////
+auto SDFFeatures::BuildSdfModel(const ::sdf::Model &_sdfModel)
+    -> SdfModelBuild
 {
   dart::dynamics::SkeletonPtr model =
       dart::dynamics::Skeleton::create(_sdfModel.Name());
 
+  std::unique_lock<std::mutex> creationLock(this->dartCreationMutex);
   dart::dynamics::SimpleFramePtr modelFrame =
       dart::dynamics::SimpleFrame::createShared(
         dart::dynamics::Frame::World(),
         _sdfModel.Name()+"_frame",
         ResolveSdfPose(_sdfModel.SemanticPose()));
+  creationLock.unlock();
 
   // Set canonical link name
-  auto [modelID, modelInfo] = this->AddModel( // NOLINT
-      {model, modelFrame, _sdfModel.CanonicalLinkName()}, _worldID);
+  SdfModelBuild build;
+  build.info = {model, modelFrame, _sdfModel.CanonicalLinkName()};
 
   model->setMobile(!_sdfModel.Static());
   model->setSelfCollisionCheck(_sdfModel.SelfCollide());
 
-  auto modelIdentity =
-      this->GenerateIdentity(modelID, this->models.at(modelID));
-
   // First, construct all links
   for (std::size_t i=0; i < _sdfModel.LinkCount(); ++i)
   {
-    this->FindOrConstructLink(
-          model, modelIdentity, _sdfModel, _sdfModel.LinkByIndex(i)->Name());
+    this->FindOrBuildLink(build.info, _sdfModel,
+                          _sdfModel.LinkByIndex(i)->Name(), build.entities);
   }
 
 
@@ -383,16 +472,132 @@ Identity SDFFeatures::ConstructSdfModel(
       continue;
     }
 
-    dart::dynamics::BodyNode * const parent = this->FindOrConstructLink(
-          model, modelIdentity, _sdfModel, sdfJoint->ParentLinkName());
+    dart::dynamics::BodyNode * const parent = this->FindOrBuildLink(
+          build.info, _sdfModel, sdfJoint->ParentLinkName(), build.entities);
+
+    dart::dynamics::BodyNode * const child = this->FindOrBuildLink(
+          build.info, _sdfModel, sdfJoint->ChildLinkName(), build.entities);
+
+    if (this->BuildSdfJoint(build.info, *sdfJoint, parent, child))
+      build.entities.push_back({PendingEntity::JOINT, child, {}});
+  }
+
+  return build;
+}
+
+/////////////////////////////////////////////////
+Identity SDFFeatures::AddSdfModel(
+    const Identity &_worldID, const SdfModelBuild &_build)
+{
+  const std::size_t modelID =
+      std::get<0>(this->AddModel(_build.info, _worldID));
+
+  for (const PendingEntity &entity : _build.entities)
+    this->AddPendingEntity(entity);
+
+  return this->GenerateIdentity(modelID, this->models.at(modelID));
+}
+
+/////////////////////////////////////////////////
+std::size_t SDFFeatures::AddPendingEntity(const PendingEntity &_entity)
+{
+  if (PendingEntity::LINK == _entity.type)
+    return this->AddLink(_entity.link);
+
+  if (PendingEntity::JOINT == _entity.type)
+    return this->AddJoint(_entity.link->getParentJoint());
+
+  return this->AddShape(_entity.shape);
+}
+
+/////////////////////////////////////////////////
+std::size_t SDFFeatures::ConstructSdfModelTemplate(
+    const Identity &/*_engineID*/,
+    const ::sdf::Model &_sdfModel)
+{
+  ModelTemplate modelTemplate;
+  modelTemplate.build = this->BuildSdfModel(_sdfModel);
+  modelTemplate.pose = modelTemplate.build.info.frame->getWorldTransform();
+
+  this->modelTemplates.push_back(std::move(modelTemplate));
+  return this->modelTemplates.size() - 1;
+}
+
+/////////////////////////////////////////////////
+Identity SDFFeatures::ConstructModelFromTemplate(
+    const Identity &_worldID,
+    const std::size_t _templateID,
+    const std::string &_name,
+    const Pose3d &_pose)
+{
+  if (_templateID >= this->modelTemplates.size())
+  {
+    ignerr << "Asked to construct a model from template [" << _templateID
+           << "], but only [" << this->modelTemplates.size() << "] templates "
+           << "have been constructed.\n";
+    return this->GenerateInvalidId();
+  }
+
+  const ModelTemplate &modelTemplate = this->modelTemplates[_templateID];
+  const ModelInfo &prototype = modelTemplate.build.info;
+
+  // The clone has the same BodyNodes in the same order as the template, and
+  // its ShapeNodes have the same names and share the shapes of the template.
+  SdfModelBuild build;
+  build.info.model = prototype.model->cloneSkeleton(_name);
+  build.info.canonicalLinkName = prototype.canonicalLinkName;
+  const dart::dynamics::SkeletonPtr &model = build.info.model;
+
+  // Move every tree of the clone so that its model frame ends up at _pose
+  const Eigen::Isometry3d tf_change = _pose * modelTemplate.pose.inverse();
+  for (std::size_t i = 0; i < model->getNumTrees(); ++i)
+  {
+    dart::dynamics::BodyNode *bn = model->getRootBodyNode(i);
+    dart::dynamics::Joint *joint = bn->getParentJoint();
+
+    auto *freeJoint = dynamic_cast<dart::dynamics::FreeJoint*>(joint);
+    if (freeJoint)
+    {
+      freeJoint->setTransform(tf_change * bn->getTransform());
+    }
+    else
+    {
+      joint->setTransformFromParentBodyNode(
+          tf_change * joint->getTransformFromParentBodyNode());
+    }
+  }
+
+  const auto *canonicalLink = dynamic_cast<const dart::dynamics::BodyNode*>(
+      prototype.frame->getParentFrame());
+  if (canonicalLink)
+  {
+    build.info.frame = dart::dynamics::SimpleFrame::createShared(
+        model->getBodyNode(canonicalLink->getIndexInSkeleton()),
+        _name + "_frame", prototype.frame->getRelativeTransform());
+  }
+  else
+  {
+    build.info.frame = dart::dynamics::SimpleFrame::createShared(
+        dart::dynamics::Frame::World(), _name + "_frame", _pose);
+  }
+
+  build.entities.reserve(modelTemplate.build.entities.size());
+  for (const PendingEntity &entity : modelTemplate.build.entities)
+  {
+    PendingEntity clonedEntity = entity;
+    clonedEntity.link =
+        model->getBodyNode(entity.link->getIndexInSkeleton());
 
-    dart::dynamics::BodyNode * const child = this->FindOrConstructLink(
-          model, modelIdentity, _sdfModel, sdfJoint->ChildLinkName());
+    if (PendingEntity::SHAPE == entity.type)
+    {
+      clonedEntity.shape.node =
+          model->getShapeNode(entity.shape.node->getName());
+    }
 
-    this->ConstructSdfJoint(modelInfo, *sdfJoint, parent, child);
+    build.entities.push_back(std::move(clonedEntity));
   }
 
-  return modelIdentity;
+  return this->AddSdfModel(_worldID, build);
 }
 
 /////////////////////////////////////////////////
@@ -401,6 +606,24 @@ Identity SDFFeatures::ConstructSdfLink(
     const ::sdf::Link &_sdfLink)
 {
   const auto &modelInfo = *this->ReferenceInterface<ModelInfo>(_modelID);
+
+  std::vector<PendingEntity> entities;
+  this->BuildSdfLink(modelInfo, _sdfLink, entities);
+
+  // The link always comes first, followed by its joint and its shapes
+  const std::size_t linkID = this->AddPendingEntity(entities.front());
+  for (std::size_t i = 1; i < entities.size(); ++i)
+    this->AddPendingEntity(entities[i]);
+
+  return this->GenerateIdentity(linkID, this->links.at(linkID));
+}
+
+/////////////////////////////////////////////////
+dart::dynamics::BodyNode *SDFFeatures::BuildSdfLink(
+    const ModelInfo &_modelInfo,
+    const ::sdf::Link &_sdfLink,
+    std::vector<PendingEntity> &_entities)
+{
   dart::dynamics::BodyNode::Properties bodyProperties;
   bodyProperties.mName = _sdfLink.Name();
 
@@ -432,40 +655,46 @@ Identity SDFFeatures::ConstructSdfLink(
   // Note: When constructing a link from this function, we always instantiate
   // it as a standalone free body within the model. If it should have any joint
   // constraints, those will be added later.
-  const auto result = modelInfo.model->createJointAndBodyNodePair<
+  std::unique_lock<std::mutex> creationLock(this->dartCreationMutex);
+  const auto result = _modelInfo.model->createJointAndBodyNodePair<
       dart::dynamics::FreeJoint>(nullptr, jointProperties, bodyProperties);
+  creationLock.unlock();
 
   dart::dynamics::FreeJoint * const joint = result.first;
   const Eigen::Isometry3d tf =
-      GetParentModelFrame(modelInfo) * ResolveSdfPose(_sdfLink.SemanticPose());
+      GetParentModelFrame(_modelInfo) * ResolveSdfPose(_sdfLink.SemanticPose());
 
   joint->setTransform(tf);
 
   dart::dynamics::BodyNode * const bn = result.second;
 
-  const std::size_t linkID = this->AddLink(bn);
-  this->AddJoint(joint);
+  _entities.push_back({PendingEntity::LINK, bn, {}});
+  _entities.push_back({PendingEntity::JOINT, bn, {}});
 
-  auto linkIdentity = this->GenerateIdentity(linkID, this->links.at(linkID));
-
-  if (_sdfLink.Name() == modelInfo.canonicalLinkName ||
-      (modelInfo.canonicalLinkName.empty() &&
-       modelInfo.model->getNumBodyNodes() == 1))
+  if (_sdfLink.Name() == _modelInfo.canonicalLinkName ||
+      (_modelInfo.canonicalLinkName.empty() &&
+       _modelInfo.model->getNumBodyNodes() == 1))
   {
     // We just added the first link, so this is now the canonical link. We
     // should therefore move the "model frame" from the world onto this new
     // link, while preserving its location in the world frame.
-    const dart::dynamics::SimpleFramePtr &modelFrame = modelInfo.frame;
+    const dart::dynamics::SimpleFramePtr &modelFrame = _modelInfo.frame;
     const Eigen::Isometry3d tf_frame = modelFrame->getWorldTransform();
+    creationLock.lock();
     modelFrame->setParentFrame(bn);
+    creationLock.unlock();
     modelFrame->setTransform(tf_frame);
   }
 
   for (std::size_t i = 0; i < _sdfLink.CollisionCount(); ++i)
   {
     const auto collision = _sdfLink.CollisionByIndex(i);
-    if (collision)
-      this->ConstructSdfCollision(linkIdentity, *collision);
+    if (!collision)
+      continue;
+
+    ShapeInfo shape = this->BuildSdfCollision(bn, *collision);
+    if (shape.node)
+      _entities.push_back({PendingEntity::SHAPE, bn, std::move(shape)});
   }
 
   // ign-physics is currently ignoring visuals, so we won't parse them from the
@@ -477,7 +706,7 @@ Identity SDFFeatures::ConstructSdfLink(
 //      this->ConstructSdfVisual(linkID, *visual);
 //  }
 
-  return linkIdentity;
+  return bn;
 }
 
 /////////////////////////////////////////////////
@@ -492,45 +721,70 @@ Identity SDFFeatures::ConstructSdfJoint(
   dart::dynamics::BodyNode * const child =
       modelInfo.model->getBodyNode(_sdfJoint.ChildLinkName());
 
-  return ConstructSdfJoint(modelInfo, _sdfJoint, parent, child);
+  DartJoint *const joint =
+      this->BuildSdfJoint(modelInfo, _sdfJoint, parent, child);
+  if (!joint)
+    return this->GenerateInvalidId();
+
+  const std::size_t jointID = this->AddJoint(joint);
+
+  return this->GenerateIdentity(jointID, this->joints.at(jointID));
 }
 
 /////////////////////////////////////////////////
 Identity SDFFeatures::ConstructSdfCollision(
     const Identity &_linkID,
     const ::sdf::Collision &_collision)
+{
+  dart::dynamics::BodyNode *const bn =
+      this->ReferenceInterface<LinkInfo>(_linkID)->link.get();
+
+  const ShapeInfo shape = this->BuildSdfCollision(bn, _collision);
+  if (!shape.node)
+    return this->GenerateInvalidId();
+
+  const std::size_t shapeID = this->AddShape(shape);
+  return this->GenerateIdentity(shapeID, this->shapes.at(shapeID));
+}
+
+/////////////////////////////////////////////////
+ShapeInfo SDFFeatures::BuildSdfCollision(
+    dart::dynamics::BodyNode *_bn,
+    const ::sdf::Collision &_collision)
 {
   if (!_collision.Geom())
   {
     ignerr << "The geometry element of collision [" << _collision.Name() << "] "
            << "was a nullptr\n";
-    return this->GenerateInvalidId();
+    return {};
   }
 
-  const ShapeAndTransform st = ConstructGeometry(*_collision.Geom());
+  std::unique_lock<std::mutex> creationLock(this->dartCreationMutex);
+
+  const ShapeAndTransform st =
+      ConstructGeometry(*_collision.Geom(), this->meshCache);
   const dart::dynamics::ShapePtr shape = st.shape;
   const Eigen::Isometry3d tf_shape = st.tf;
 
   if (!shape)
   {
     // The geometry element was empty, or the shape type is not supported
-    return this->GenerateInvalidId();
+    return {};
   }
 
-  dart::dynamics::BodyNode *const bn =
-      this->ReferenceInterface<LinkInfo>(_linkID)->link.get();
-
   // NOTE(MXG): Gazebo requires unique collision shape names per Link, but
   // dartsim requires unique ShapeNode names per Skeleton, so we decorate the
   // Collision name for uniqueness sake.
   const std::string internalName =
-      bn->getName() + ":" + _collision.Name();
+      _bn->getName() + ":" + _collision.Name();
 
   dart::dynamics::ShapeNode * const node =
-      bn->createShapeNodeWith<
+      _bn->createShapeNodeWith<
         dart::dynamics::CollisionAspect, dart::dynamics::DynamicsAspect>(
           shape, internalName);
 
+  creationLock.unlock();
+
   // Calling GetElement creates a new element with default values if the element
   // doesn't exist, so the following is okay.
   // TODO(addisu) We are using the coefficient specified in the <ode> tag.
@@ -568,16 +822,14 @@ Identity SDFFeatures::ConstructSdfCollision(
     // elements, the value of the last one will be the coefficient for the link.
     // TODO(addisu) Assign the coefficient to the shape node when support is
     // added in DART.
-    bn->setFrictionCoeff(odeFriction->Get<double>("mu"));
+    _bn->setFrictionCoeff(odeFriction->Get<double>("mu"));
 #endif
   }
 
   node->setRelativeTransform(ResolveSdfPose(_collision.SemanticPose()) *
                              tf_shape);
 
-  const std::size_t shapeID =
-      this->AddShape({node, _collision.Name(), tf_shape});
-  return this->GenerateIdentity(shapeID, this->shapes.at(shapeID));
+  return {node, _collision.Name(), tf_shape};
 }
 
 /////////////////////////////////////////////////
@@ -592,7 +844,8 @@ Identity SDFFeatures::ConstructSdfVisual(
     return this->GenerateInvalidId();
   }
 
-  const ShapeAndTransform st = ConstructGeometry(*_visual.Geom());
+  const ShapeAndTransform st =
+      ConstructGeometry(*_visual.Geom(), this->meshCache);
   const dart::dynamics::ShapePtr shape = st.shape;
   const Eigen::Isometry3d tf_shape = st.tf;
 
@@ -631,13 +884,27 @@ Identity SDFFeatures::ConstructSdfVisual(
 }
 
 /////////////////////////////////////////////////
-dart::dynamics::BodyNode *SDFFeatures::FindOrConstructLink(
-    const dart::dynamics::SkeletonPtr &_model,
-    const Identity &_modelID,
+void SDFFeatures::SetEngineConstructWorldThreadCount(
+    const Identity &/*_engineID*/, const std::size_t _count)
+{
+  this->constructWorldThreadCount = _count;
+}
+
+/////////////////////////////////////////////////
+std::size_t SDFFeatures::GetEngineConstructWorldThreadCount(
+    const Identity &/*_engineID*/) const
+{
+  return this->constructWorldThreadCount;
+}
+
+/////////////////////////////////////////////////
+dart::dynamics::BodyNode *SDFFeatures::FindOrBuildLink(
+    const ModelInfo &_modelInfo,
     const ::sdf::Model &_sdfModel,
-    const std::string &_linkName)
+    const std::string &_linkName,
+    std::vector<PendingEntity> &_entities)
 {
-  dart::dynamics::BodyNode * link = _model->getBodyNode(_linkName);
+  dart::dynamics::BodyNode * link = _modelInfo.model->getBodyNode(_linkName);
   if (link)
     return link;
 
@@ -652,11 +919,11 @@ dart::dynamics::BodyNode *SDFFeatures::FindOrConstructLink(
     return nullptr;
   }
 
-  return this->links.at(this->ConstructSdfLink(_modelID, *sdfLink))->link.get();
+  return this->BuildSdfLink(_modelInfo, *sdfLink, _entities);
 }
 
 /////////////////////////////////////////////////
-Identity SDFFeatures::ConstructSdfJoint(
+dart::dynamics::Joint *SDFFeatures::BuildSdfJoint(
     const ModelInfo &_modelInfo,
     const ::sdf::Joint &_sdfJoint,
     dart::dynamics::BodyNode * const _parent,
@@ -673,7 +940,7 @@ Identity SDFFeatures::ConstructSdfJoint(
            << "[" << _modelInfo.model->getName() << "]. This is currently not "
            << "supported\n";
 
-    return this->GenerateInvalidId();
+    return nullptr;
   }
 
   // If either parent or child is null, it's only an error if the link is not
@@ -699,7 +966,7 @@ Identity SDFFeatures::ConstructSdfJoint(
       msg << "could not be found in that model!\n";
       ignerr << msg.str();
 
-      return this->GenerateInvalidId();
+      return nullptr;
     }
   }
 
@@ -711,7 +978,7 @@ Identity SDFFeatures::ConstructSdfJoint(
       ignerr << "Asked to create a closed kinematic chain between links "
              << "[" << _parent->getName() << "] and [" << _child->getName()
              << "], but that is not supported by the dartsim wrapper yet.\n";
-      return this->GenerateInvalidId();
+      return nullptr;
     }
   }
 
@@ -726,6 +993,8 @@ Identity SDFFeatures::ConstructSdfJoint(
   const ::sdf::JointType type = _sdfJoint.Type();
   dart::dynamics::Joint *joint = nullptr;
 
+  // Moving the child changes its parent frame
+  std::unique_lock<std::mutex> creationLock(this->dartCreationMutex);
   if (::sdf::JointType::BALL == type)
   {
     // SDF does not support any of the properties for ball joint, besides the
@@ -781,6 +1050,7 @@ Identity SDFFeatures::ConstructSdfJoint(
     // transforms to its parent and child, which will be taken care of below.
     joint = _child->moveTo<dart::dynamics::WeldJoint>(_parent);
   }
+  creationLock.unlock();
 
   joint->setName(_sdfJoint.Name());
 
@@ -815,9 +1085,7 @@ Identity SDFFeatures::ConstructSdfJoint(
 
   joint->setTransformFromParentBodyNode(parent_T_prejoint_final);
 
-  const std::size_t jointID = this->AddJoint(joint);
-
-  return this->GenerateIdentity(jointID, this->joints.at(jointID));
+  return joint;
 }
 
 /////////////////////////////////////////////////
@@ -18,12 +18,15 @@
 #ifndef IGNITION_PHYSICS_DARTSIM_SRC_SDFFEATURES_HH_
 #define IGNITION_PHYSICS_DARTSIM_SRC_SDFFEATURES_HH_
 
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include <ignition/physics/sdf/ConstructCollision.hh>
 #include <ignition/physics/sdf/ConstructJoint.hh>
 #include <ignition/physics/sdf/ConstructLink.hh>
 #include <ignition/physics/sdf/ConstructModel.hh>
+#include <ignition/physics/sdf/ConstructModelTemplate.hh>
 #include <ignition/physics/sdf/ConstructVisual.hh>
 #include <ignition/physics/sdf/ConstructWorld.hh>
 
@@ -31,6 +34,7 @@
 
 #include "Base.hh"
 #include "EntityManagementFeatures.hh"
+#include "MeshCache.hh"
 
 namespace ignition {
 namespace physics {
@@ -42,7 +46,9 @@ struct SDFFeatureList : FeatureList<
   sdf::ConstructSdfLink,
   sdf::ConstructSdfJoint,
   sdf::ConstructSdfCollision,
-  sdf::ConstructSdfVisual
+  sdf::ConstructSdfVisual,
+  sdf::ParallelConstructSdfWorld,
+  sdf::ConstructSdfModelTemplate
 > { };
 
 class SDFFeatures :
@@ -73,20 +79,104 @@ class SDFFeatures :
       const Identity &_linkID,
       const ::sdf::Visual &_visual) override;
 
-  private: dart::dynamics::BodyNode *FindOrConstructLink(
-      const dart::dynamics::SkeletonPtr &_model,
-      const Identity &_modelID,
-      const ::sdf::Model &_sdfModel,
-      const std::string &_linkName);
+  public: void SetEngineConstructWorldThreadCount(
+      const Identity &_engineID, std::size_t _count) override;
+
+  public: std::size_t GetEngineConstructWorldThreadCount(
+      const Identity &_engineID) const override;
+
+  public: std::size_t ConstructSdfModelTemplate(
+      const Identity &_engineID,
+      const ::sdf::Model &_sdfModel) override;
 
-  /// \brief Construct a joint between two input links.
+  public: Identity ConstructModelFromTemplate(
+      const Identity &_worldID,
+      std::size_t _templateID,
+      const std::string &_name,
+      const Pose3d &_pose) override;
+
+  /// \brief A link, joint or shape that has been built, but not added to the
+  /// entity storages yet
+  private: struct PendingEntity
+  {
+    enum Type { LINK, JOINT, SHAPE };
+
+    Type type;
+
+    /// \brief The link itself, or the child link of a joint. A joint is
+    /// referred to by its child link, because building a joint later on
+    /// replaces the parent joint of its child link.
+    DartBodyNode *link = nullptr;
+
+    /// \brief The shape, only used by SHAPE entities
+    ShapeInfo shape;
+  };
+
+  /// \brief A model that has been built from an SDF model, together with its
+  /// entities in the order in which they must be added to the entity
+  /// storages
+  private: struct SdfModelBuild
+  {
+    ModelInfo info;
+    std::vector<PendingEntity> entities;
+  };
+
+  /// \brief A model built by ConstructSdfModelTemplate. Its skeleton does
+  /// not belong to any world, and is cloned for every new copy.
+  private: struct ModelTemplate
+  {
+    SdfModelBuild build;
+
+    /// \brief World pose of the model frame of the SDF model
+    Eigen::Isometry3d pose;
+  };
+
+  /// \brief Build the skeleton of an SDF model. This does not modify
+  /// anything that is shared with other models, so several models can be
+  /// built at the same time.
+  private: SdfModelBuild BuildSdfModel(const ::sdf::Model &_sdfModel);
+
+  /// \brief Add a model which was built by BuildSdfModel to a world, and add
+  /// its entities to the entity storages
+  private: Identity AddSdfModel(
+      const Identity &_worldID, const SdfModelBuild &_build);
+
+  /// \brief Add a pending entity to its entity storage
+  /// \return The ID of the entity
+  private: std::size_t AddPendingEntity(const PendingEntity &_entity);
+
+  private: DartBodyNode *FindOrBuildLink(
+      const ModelInfo &_modelInfo,
+      const ::sdf::Model &_sdfModel,
+      const std::string &_linkName,
+      std::vector<PendingEntity> &_entities);
+
+  /// \brief Build a link and its collisions.
+  /// \param[in] _modelInfo Contains the link's model
+  /// \param[in] _sdfLink Contains link parameters
+  /// \param[out] _entities The link, its joint and its shapes are appended
+  /// \return The link
+  private: DartBodyNode *BuildSdfLink(
+      const ModelInfo &_modelInfo,
+      const ::sdf::Link &_sdfLink,
+      std::vector<PendingEntity> &_entities);
+
+  /// \brief Build a collision shape on a link.
+  /// \return The shape. Its node is a nullptr if the geometry is missing or
+  /// not supported.
+  private: ShapeInfo BuildSdfCollision(
+      DartBodyNode *_bn,
+      const ::sdf::Collision &_collision);
+
+  /// \brief Build a joint between two input links.
   /// \param[in] _modelInfo Contains the joint's parent model
   /// \param[in] _sdfJoint Contains joint parameters
   /// \param[in] _parent Pointer to parent link. If nullptr, the parent is
   /// assumed to be world
   /// \param[in] _child Pointer to child link. If nullptr, the child is assumed
   /// to be world
-  private: Identity ConstructSdfJoint(const ModelInfo &_modelInfo,
+  /// \return The joint, or a nullptr if it could not be built
+  private: DartJoint *BuildSdfJoint(const ModelInfo &_modelInfo,
       const ::sdf::Joint &_sdfJoint,
       dart::dynamics::BodyNode * const _parent,
       dart::dynamics::BodyNode * const _child);
@@ -98,6 +188,26 @@ class SDFFeatures :
   private: Eigen::Isometry3d ResolveSdfJointReferenceFrame(
       const std::string &_frame,
       const dart::dynamics::BodyNode *_child) const;
+
+  /// \brief Shapes of the mesh files that have been loaded, shared by every
+  /// world of the engine
+  private: MeshCache meshCache;
+
+  /// \brief Templates built by ConstructSdfModelTemplate, indexed by
+  /// template ID
+  private: std::vector<ModelTemplate> modelTemplates;
+
+  /// \brief Maximum number of threads used by ConstructSdfWorld
+  private: std::size_t constructWorldThreadCount = 1;
+
+  /// \brief Serializes the creation of BodyNodes, Shapes and ShapeNodes, and
+  /// every change of the parent of a frame, while models are built
+  /// concurrently. dartsim numbers BodyNodes and Shapes with unsynchronized
+  /// counters, a ShapeNode connects to its shape, which may be shared with
+  /// other models through the meshCache, and every frame that is created
+  /// under or moved away from the world frame modifies the set of children
+  /// of Frame::World(), which all the models share.
+  private: std::mutex dartCreationMutex;
 };
 
 }
@@ -18,22 +18,28 @@
 #include <dart/dynamics/BodyNode.hpp>
 #include <dart/dynamics/DegreeOfFreedom.hpp>
 #include <dart/dynamics/FreeJoint.hpp>
+#include <dart/dynamics/MeshShape.hpp>
 #include <dart/dynamics/RevoluteJoint.hpp>
 #include <dart/dynamics/ScrewJoint.hpp>
+#include <dart/dynamics/ShapeNode.hpp>
 #include <dart/dynamics/WeldJoint.hpp>
 
 #include <gtest/gtest.h>
 
+#include <string>
 #include <tuple>
+#include <vector>
 
 #include <ignition/plugin/Loader.hh>
 
+#include <ignition/physics/GetEntities.hh>
 #include <ignition/physics/Joint.hh>
 #include <ignition/physics/RequestEngine.hh>
 
 #include <ignition/physics/sdf/ConstructJoint.hh>
 #include <ignition/physics/sdf/ConstructLink.hh>
 #include <ignition/physics/sdf/ConstructModel.hh>
+#include <ignition/physics/sdf/ConstructModelTemplate.hh>
 #include <ignition/physics/sdf/ConstructWorld.hh>
 
 #include <ignition/physics/dartsim/World.hh>
@@ -45,12 +51,15 @@
 
 struct TestFeatureList : ignition::physics::FeatureList<
     ignition::physics::GetBasicJointState,
+    ignition::physics::GetEntities,
     ignition::physics::SetBasicJointState,
     ignition::physics::dartsim::RetrieveWorld,
     ignition::physics::sdf::ConstructSdfJoint,
     ignition::physics::sdf::ConstructSdfLink,
     ignition::physics::sdf::ConstructSdfModel,
-    ignition::physics::sdf::ConstructSdfWorld
+    ignition::physics::sdf::ConstructSdfModelTemplate,
+    ignition::physics::sdf::ConstructSdfWorld,
+    ignition::physics::sdf::ParallelConstructSdfWorld
 > { };
 
 using World = ignition::physics::World3d<TestFeatureList>;
@@ -498,6 +507,336 @@ TEST(SDFFeatures_FrameSemantics, ExplicitWorldFrames)
       expPose, link1->getWorldTransform(), 1e-5));
 }
 
+// Test that mesh collisions are loaded, and that every collision with the same
+// mesh file and scale shares a single shape.
+TEST(SDFFeatures_TEST, SharedMeshes)
+{
+  auto engine = LoadEngine();
+  ASSERT_NE(nullptr, engine);
+
+  const auto meshModel = [](const std::string &_name, const std::string &_scale)
+  {
+    return
+      "<model name='" + _name + "'>"
+      "  <link name='link'>"
+      "    <collision name='collision'>"
+      "      <geometry><mesh>"
+      "        <uri>file://" IGNITION_PHYSICS_RESOURCE_DIR "/chassis.dae</uri>"
+      "        <scale>" + _scale + "</scale>"
+      "      </mesh></geometry>"
+      "    </collision>"
+      "  </link>"
+      "</model>";
+  };
+
+  sdf::Root root;
+  const sdf::Errors errors = root.LoadSdfString(
+      "<sdf version='1.6'><world name='meshes'>"
+      + meshModel("mesh_0", "1 1 1") + meshModel("mesh_1", "1 1 1")
+      + meshModel("small_mesh", "0.5 0.5 0.5") + "</world></sdf>");
+  ASSERT_TRUE(errors.empty());
+
+  auto world = engine->ConstructWorld(*root.WorldByIndex(0));
+  ASSERT_NE(nullptr, world);
+
+  dart::simulation::WorldPtr dartWorld = world->GetDartsimWorld();
+  ASSERT_NE(nullptr, dartWorld);
+
+  const auto shapeOf = [&](const std::string &_model)
+  {
+    const auto skeleton = dartWorld->getSkeleton(_model);
+    EXPECT_NE(nullptr, skeleton);
+    EXPECT_EQ(1u, skeleton->getBodyNode(0)->getNumShapeNodes());
+    return skeleton->getBodyNode(0)->getShapeNode(0)->getShape();
+  };
+
+  const auto shape0 = shapeOf("mesh_0");
+  const auto shape1 = shapeOf("mesh_1");
+  const auto smallShape = shapeOf("small_mesh");
+  ASSERT_NE(nullptr, shape0);
+  ASSERT_NE(nullptr, smallShape);
+
+  EXPECT_EQ(shape0, shape1);
+  EXPECT_NE(shape0, smallShape);
+
+  const Eigen::Vector3d size = shape0->getBoundingBox().computeFullExtents();
+  const Eigen::Vector3d smallSize =
+      smallShape->getBoundingBox().computeFullExtents();
+  EXPECT_NEAR(0.5106, size[0], 1e-4);
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      Eigen::Vector3d(0.5 * size), smallSize, 1e-6));
+}
+
+// Test that a relative mesh URI is resolved against the SDF file that it is
+// in, rather than against the working directory.
+TEST(SDFFeatures_TEST, RelativeMeshUri)
+{
+  auto engine = LoadEngine();
+  ASSERT_NE(nullptr, engine);
+
+  sdf::Root root;
+  const sdf::Errors errors = root.Load(TEST_WORLD_DIR "relative_mesh.sdf");
+  ASSERT_TRUE(errors.empty()) << errors.front();
+
+  auto world = engine->ConstructWorld(*root.WorldByIndex(0));
+  ASSERT_NE(nullptr, world);
+
+  dart::simulation::WorldPtr dartWorld = world->GetDartsimWorld();
+  ASSERT_NE(nullptr, dartWorld);
+
+  const auto skeleton = dartWorld->getSkeleton("mesh");
+  ASSERT_NE(nullptr, skeleton);
+  ASSERT_EQ(1u, skeleton->getBodyNode(0)->getNumShapeNodes());
+  EXPECT_NE(nullptr, skeleton->getBodyNode(0)->getShapeNode(0)->getShape());
+}
+
+// Test that a world constructed on several threads is identical to one
+// constructed on a single thread, down to the entity IDs.
+TEST(SDFFeatures_TEST, ParallelConstructWorld)
+{
+  sdf::Root root;
+  const sdf::Errors errors = root.Load(TEST_WORLD_DIR"/test.world");
+  ASSERT_TRUE(errors.empty());
+  const sdf::World *sdfWorld = root.WorldByIndex(0);
+  ASSERT_NE(nullptr, sdfWorld);
+
+  auto serialEngine = LoadEngine();
+  ASSERT_NE(nullptr, serialEngine);
+  EXPECT_EQ(1u, serialEngine->GetConstructWorldThreadCount());
+  auto serialWorld = serialEngine->ConstructWorld(*sdfWorld);
+  ASSERT_NE(nullptr, serialWorld);
+
+  auto parallelEngine = LoadEngine();
+  ASSERT_NE(nullptr, parallelEngine);
+  parallelEngine->SetConstructWorldThreadCount(4);
+  EXPECT_EQ(4u, parallelEngine->GetConstructWorldThreadCount());
+  auto parallelWorld = parallelEngine->ConstructWorld(*sdfWorld);
+  ASSERT_NE(nullptr, parallelWorld);
+
+  EXPECT_EQ(serialWorld->EntityID(), parallelWorld->EntityID());
+  ASSERT_EQ(serialWorld->GetModelCount(), parallelWorld->GetModelCount());
+  for (std::size_t i = 0; i < serialWorld->GetModelCount(); ++i)
+  {
+    const auto serialModel = serialWorld->GetModel(i);
+    const auto parallelModel = parallelWorld->GetModel(i);
+    EXPECT_EQ(serialModel->GetName(), parallelModel->GetName());
+    EXPECT_EQ(serialModel->EntityID(), parallelModel->EntityID());
+
+    ASSERT_EQ(serialModel->GetLinkCount(), parallelModel->GetLinkCount());
+    for (std::size_t j = 0; j < serialModel->GetLinkCount(); ++j)
+    {
+      const auto serialLink = serialModel->GetLink(j);
+      const auto parallelLink = parallelModel->GetLink(j);
+      EXPECT_EQ(serialLink->GetName(), parallelLink->GetName());
+      EXPECT_EQ(serialLink->EntityID(), parallelLink->EntityID());
+
+      ASSERT_EQ(serialLink->GetShapeCount(), parallelLink->GetShapeCount());
+      for (std::size_t k = 0; k < serialLink->GetShapeCount(); ++k)
+      {
+        EXPECT_EQ(serialLink->GetShape(k)->EntityID(),
+                  parallelLink->GetShape(k)->EntityID());
+      }
+    }
+
+    ASSERT_EQ(serialModel->GetJointCount(), parallelModel->GetJointCount());
+    for (std::size_t j = 0; j < serialModel->GetJointCount(); ++j)
+    {
+      const auto serialJoint = serialModel->GetJoint(j);
+      const auto parallelJoint = parallelModel->GetJoint(j);
+      EXPECT_EQ(serialJoint->GetName(), parallelJoint->GetName());
+      EXPECT_EQ(serialJoint->EntityID(), parallelJoint->EntityID());
+    }
+  }
+
+  const auto serialDartWorld = serialWorld->GetDartsimWorld();
+  const auto parallelDartWorld = parallelWorld->GetDartsimWorld();
+  for (std::size_t i = 0; i < serialDartWorld->getNumSkeletons(); ++i)
+  {
+    const auto serialSkeleton = serialDartWorld->getSkeleton(i);
+    const auto parallelSkeleton = parallelDartWorld->getSkeleton(i);
+    ASSERT_EQ(serialSkeleton->getNumBodyNodes(),
+              parallelSkeleton->getNumBodyNodes());
+    for (std::size_t j = 0; j < serialSkeleton->getNumBodyNodes(); ++j)
+    {
+      EXPECT_TRUE(ignition::physics::test::Equal(
+          serialSkeleton->getBodyNode(j)->getWorldTransform(),
+          parallelSkeleton->getBodyNode(j)->getWorldTransform(), 0.0));
+    }
+  }
+}
+
+// Stress the parallel construction with many models whose frames are all
+// created under, and then moved away from, the world frame at the same time.
+TEST(SDFFeatures_TEST, ParallelConstructManyModels)
+{
+  std::string sdfString = "<sdf version='1.6'><world name='many'>";
+  for (std::size_t i = 0; i < 200; ++i)
+  {
+    sdfString +=
+        "<model name='model_" + std::to_string(i) + "'>"
+        "  <pose>" + std::to_string(i) + " 0 0 0 0 0</pose>"
+        "  <link name='base'>"
+        "    <collision name='collision'>"
+        "      <geometry><box><size>1 1 1</size></box></geometry>"
+        "    </collision>"
+        "  </link>"
+        "  <link name='arm'>"
+        "    <pose>0 0 1 0 0 0</pose>"
+        "    <collision name='collision'>"
+        "      <geometry><sphere><radius>0.1</radius></sphere></geometry>"
+        "    </collision>"
+        "  </link>"
+        "  <joint name='joint' type='revolute'>"
+        "    <parent>base</parent>"
+        "    <child>arm</child>"
+        "  </joint>"
+        "  <joint name='fixed' type='fixed'>"
+        "    <parent>world</parent>"
+        "    <child>base</child>"
+        "  </joint>"
+        "</model>";
+  }
+  sdfString += "</world></sdf>";
+
+  sdf::Root root;
+  ASSERT_TRUE(root.LoadSdfString(sdfString).empty());
+  const sdf::World *sdfWorld = root.WorldByIndex(0);
+  ASSERT_NE(nullptr, sdfWorld);
+
+  for (std::size_t run = 0; run < 10; ++run)
+  {
+    auto engine = LoadEngine();
+    ASSERT_NE(nullptr, engine);
+    engine->SetConstructWorldThreadCount(8);
+    auto world = engine->ConstructWorld(*sdfWorld);
+    ASSERT_NE(nullptr, world);
+    ASSERT_EQ(200u, world->GetModelCount());
+
+    const auto dartWorld = world->GetDartsimWorld();
+    for (std::size_t i = 0; i < world->GetModelCount(); ++i)
+    {
+      const auto model = world->GetModel(i);
+      ASSERT_EQ(2u, model->GetLinkCount());
+      ASSERT_EQ(2u, model->GetJointCount());
+
+      const auto skeleton = dartWorld->getSkeleton(model->GetName());
+      ASSERT_NE(nullptr, skeleton);
+      const Eigen::Vector3d basePos(static_cast<double>(i), 0, 0);
+      EXPECT_TRUE(ignition::physics::test::Equal(basePos,
+          skeleton->getBodyNode("base")->getWorldTransform().translation(),
+          1e-9));
+      EXPECT_TRUE(ignition::physics::test::Equal(
+          Eigen::Vector3d(basePos + Eigen::Vector3d::UnitZ()),
+          skeleton->getBodyNode("arm")->getWorldTransform().translation(),
+          1e-9));
+    }
+  }
+}
+
+// Test that copies of a model template are placed at the requested poses and
+// get their own entities
+TEST(SDFFeatures_TEST, ModelTemplate)
+{
+  auto engine = LoadEngine();
+  ASSERT_NE(nullptr, engine);
+
+  sdf::Root root;
+  const sdf::Errors errors = root.LoadSdfString(
+      "<sdf version='1.6'><world name='templates'>"
+      "  <model name='arm'>"
+      "    <pose>1 0 0 0 0 0</pose>"
+      "    <link name='base'>"
+      "      <collision name='collision'>"
+      "        <geometry><box><size>1 1 1</size></box></geometry>"
+      "      </collision>"
+      "    </link>"
+      "    <link name='upper'>"
+      "      <pose>0 0 1 0 0 0</pose>"
+      "      <collision name='collision'>"
+      "        <geometry><box><size>0.1 0.1 1</size></box></geometry>"
+      "      </collision>"
+      "    </link>"
+      "    <joint name='shoulder' type='revolute'>"
+      "      <parent>base</parent>"
+      "      <child>upper</child>"
+      "      <axis><xyz>0 1 0</xyz></axis>"
+      "    </joint>"
+      "  </model>"
+      "</world></sdf>");
+  ASSERT_TRUE(errors.empty());
+  const sdf::World *sdfWorld = root.WorldByIndex(0);
+  ASSERT_NE(nullptr, sdfWorld);
+
+  auto world = engine->ConstructWorld(*sdfWorld);
+  ASSERT_NE(nullptr, world);
+  EXPECT_EQ(1u, world->GetModelCount());
+
+  const std::size_t templateID =
+      engine->ConstructModelTemplate(*sdfWorld->ModelByIndex(0));
+
+  // Building a template does not add anything to the world
+  EXPECT_EQ(1u, world->GetModelCount());
+
+  const std::vector<Eigen::Isometry3d> poses = {
+    Eigen::Isometry3d(Eigen::Translation3d(0, 5, 0)),
+    Eigen::Translation3d(-3, 0, 2)
+        * Eigen::AngleAxisd(0.5 * IGN_PI, Eigen::Vector3d::UnitZ())
+  };
+
+  dart::simulation::WorldPtr dartWorld = world->GetDartsimWorld();
+  ASSERT_NE(nullptr, dartWorld);
+
+  std::vector<dart::dynamics::ShapePtr> shapes;
+  for (std::size_t i = 0; i < poses.size(); ++i)
+  {
+    const std::string name = "arm_" + std::to_string(i);
+    auto model =
+        world->ConstructModelFromTemplate(templateID, name, poses[i]);
+    ASSERT_NE(nullptr, model);
+
+    EXPECT_EQ(name, model->GetName());
+    EXPECT_EQ(2u + i, world->GetModelCount());
+    EXPECT_EQ(model->EntityID(), world->GetModel(name)->EntityID());
+    ASSERT_EQ(2u, model->GetLinkCount());
+    ASSERT_EQ(1u, model->GetJointCount());
+    EXPECT_EQ("shoulder", model->GetJoint(0)->GetName());
+
+    auto base = model->GetLink("base");
+    auto upper = model->GetLink("upper");
+    ASSERT_NE(nullptr, base);
+    ASSERT_NE(nullptr, upper);
+    EXPECT_NE(base->EntityID(), upper->EntityID());
+    EXPECT_EQ(1u, base->GetShapeCount());
+    EXPECT_EQ(1u, upper->GetShapeCount());
+
+    const auto skeleton = dartWorld->getSkeleton(name);
+    ASSERT_NE(nullptr, skeleton);
+    EXPECT_TRUE(ignition::physics::test::Equal(
+        poses[i], skeleton->getBodyNode("base")->getWorldTransform(), 1e-9));
+    EXPECT_TRUE(ignition::physics::test::Equal(
+        Eigen::Isometry3d(poses[i] * Eigen::Translation3d(0, 0, 1)),
+        skeleton->getBodyNode("upper")->getWorldTransform(), 1e-9));
+
+    shapes.push_back(
+        skeleton->getBodyNode("upper")->getShapeNode(0)->getShape());
+  }
+
+  // Copies of a template share its shapes
+  ASSERT_NE(nullptr, shapes.front());
+  EXPECT_EQ(shapes.front(), shapes.back());
+
+  // The model constructed from SDF is not affected by the copies
+  const auto original = dartWorld->getSkeleton("arm");
+  ASSERT_NE(nullptr, original);
+  EXPECT_TRUE(ignition::physics::test::Equal(
+      Eigen::Isometry3d(Eigen::Translation3d(1, 0, 0)),
+      original->getBodyNode("base")->getWorldTransform(), 1e-9));
+
+  EXPECT_EQ(nullptr, world->ConstructModelFromTemplate(
+      templateID + 1, "missing", Eigen::Isometry3d::Identity()));
+  EXPECT_EQ(3u, world->GetModelCount());
+}
+
 int main(int argc, char *argv[])
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -43,6 +43,7 @@ void ShapeFeatures::SetShapeRelativeTransform(
 {
   const auto *shapeInfo = this->ReferenceInterface<ShapeInfo>(_shapeID);
   shapeInfo->node->setRelativeTransform(_pose * shapeInfo->tf_offset);
+  this->InvalidateFrameDataCache();
 }
 
 /////////////////////////////////////////////////
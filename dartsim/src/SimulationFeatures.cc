@@ -17,6 +17,21 @@
 
 #include <dart/collision/CollisionObject.hpp>
 #include <dart/collision/CollisionResult.hpp>
+#include <dart/dynamics/Frame.hpp>
+#include <dart/dynamics/JacobianNode.hpp>
+
+#include <ode/ode.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <ignition/math/eigen3/Conversions.hh>
 
 #include "SimulationFeatures.hh"
 
@@ -26,13 +41,116 @@ namespace ignition {
 namespace physics {
 namespace dartsim {
 
+namespace {
+/////////////////////////////////////////////////
+/// \brief The integral of the position error of each joint that received
+/// ServoControlCommands, indexed by the entity ID of the joint. It is kept in
+/// the ForwardStep::State of the world between steps.
+struct ServoErrorIntegrals
+{
+  std::unordered_map<std::size_t, std::vector<double>> integrals;
+};
+
+/////////////////////////////////////////////////
+/// \brief The time which StepAccumulator has accumulated but not stepped
+/// yet. It is kept in the ForwardStep::State of the world between steps.
+struct AccumulatedTime
+{
+  double time = 0.0;
+};
+
+/////////////////////////////////////////////////
+/// \brief Check whether a skeleton belongs to _world. Skeleton names are
+/// unique within a world, so this only takes a lookup by name.
+bool InWorld(
+    const dart::simulation::World &_world,
+    const dart::dynamics::Skeleton &_skel)
+{
+  return _world.getSkeleton(_skel.getName()).get() == &_skel;
+}
+
+/////////////////////////////////////////////////
+/// \brief Check whether a frame is the world frame or belongs to _world
+bool InWorld(
+    const dart::simulation::World &_world,
+    const dart::dynamics::Frame &_frame)
+{
+  if (_frame.isWorld())
+    return true;
+
+  const auto *node = dynamic_cast<const dart::dynamics::JacobianNode*>(&_frame);
+  return node && InWorld(_world, *node->getSkeleton());
+}
+
+/////////////////////////////////////////////////
+/// \brief Call _function(jointID, joint, dof, value) for each value of
+/// _parameters.
+/// Each entry of GeneralizedParameters::dofs is the entity ID of a joint, and
+/// consecutive entries of the same joint refer to its degrees of freedom in
+/// order. This matches the layout of the JointPositions output. Joints which
+/// are not in _world are skipped, so that stepping a world never touches
+/// another one.
+template <typename JointStorage, typename Function>
+void ForEachDof(
+    const dart::simulation::World &_world,
+    const JointStorage &_joints,
+    const GeneralizedParameters &_parameters,
+    Function _function)
+{
+  if (_parameters.dofs.size() != _parameters.forces.size())
+  {
+    ignerr << "Given [" << _parameters.forces.size() << "] values for ["
+           << _parameters.dofs.size() << "] degrees of freedom. The values "
+           << "will be ignored.\n";
+    return;
+  }
+
+  std::size_t dof = 0;
+  for (std::size_t i = 0; i < _parameters.dofs.size(); ++i)
+  {
+    const std::size_t jointID = _parameters.dofs[i];
+    dof = (i > 0 && _parameters.dofs[i-1] == jointID) ? dof + 1 : 0;
+
+    const auto *jointInfo = _joints.Find(jointID);
+    if (!jointInfo)
+    {
+      ignerr << "Given a value for joint [" << jointID << "], which does not "
+             << "exist. The value will be ignored.\n";
+      continue;
+    }
+
+    dart::dynamics::Joint *joint = (*jointInfo)->joint.get();
+    if (!InWorld(_world, *joint->getSkeleton()))
+    {
+      ignerr << "Given a value for joint [" << joint->getName() << "], which "
+             << "is not in world [" << _world.getName() << "]. The value will "
+             << "be ignored.\n";
+      continue;
+    }
+
+    if (dof >= joint->getNumDofs())
+    {
+      ignerr << "Given a value for degree of freedom [" << dof << "] of joint ["
+             << joint->getName() << "], which only has ["
+             << joint->getNumDofs() << "]. The value will be ignored.\n";
+      continue;
+    }
+
+    _function(jointID, *joint, dof, _parameters.forces[i]);
+  }
+}
+}
+
+/////////////////////////////////////////////////
 void SimulationFeatures::WorldForwardStep(
     const Identity &_worldID,
-    ForwardStep::Output & /*_h*/,
-    ForwardStep::State & /*_x*/,
+    ForwardStep::Output &_h,
+    ForwardStep::State &_x,
     const ForwardStep::Input & _u)
 {
   IGN_PROFILE("SimulationFeatures::WorldForwardStep");
+  this->RegisterPendingSkeletons(_worldID);
+
   auto *world = this->ReferenceInterface<DartWorld>(_worldID);
   auto *dtDur =
       _u.Query<std::chrono::steady_clock::duration>();
@@ -49,9 +167,327 @@ void SimulationFeatures::WorldForwardStep(
     }
   }
 
-  // TODO(MXG): Parse input
-  world->step();
-  // TODO(MXG): Fill in output and state
+  const std::size_t numSteps = this->NumInternalSteps(*world, _x, _u);
+
+  // DART clears the commands after each step, so they are applied again
+  // before each internal step.
+  for (std::size_t i = 0; i < numSteps; ++i)
+  {
+    this->ApplyInputs(*world, _x, _u);
+    world->step();
+  }
+  this->InvalidateFrameDataCache();
+
+  // The output objects are overwritten in place, so a caller that passes the
+  // same Output every step does not cause any new allocations once the
+  // vectors have grown to the size of the world.
+  _h.ResetQueries();
+  this->WriteWorldPoses(*world, _h.Get<WorldPoses>());
+  this->WriteJointPositions(*world, _h.Get<JointPositions>());
+  this->WriteContacts(*world, _h.Get<Contacts>());
+  this->PublishSnapshot(_worldID, *world);
+
+  // TODO(MXG): Fill in state
+}
+
+/////////////////////////////////////////////////
+std::size_t SimulationFeatures::NumInternalSteps(
+    const DartWorld &_world,
+    ForwardStep::State &_x,
+    const ForwardStep::Input &_u) const
+{
+  if (const auto *accumulator = _u.Query<StepAccumulator>())
+  {
+    double &accumulated = _x.Get<AccumulatedTime>().time;
+    accumulated += accumulator->elapsed;
+
+    // The tolerance keeps rounding errors from postponing a step when the
+    // elapsed times add up to a multiple of the time step.
+    const double timeStep = _world.getTimeStep();
+    const double steps = std::floor(accumulated / timeStep + 1e-6);
+    const std::size_t numSteps =
+        steps > 0.0 ? static_cast<std::size_t>(steps) : 0u;
+
+    if (accumulator->maxSteps > 0 && numSteps > accumulator->maxSteps)
+    {
+      accumulated = 0.0;
+      return accumulator->maxSteps;
+    }
+
+    accumulated = std::max(
+          0.0, accumulated - static_cast<double>(numSteps) * timeStep);
+    return numSteps;
+  }
+
+  if (const auto *subSteps = _u.Query<SubSteps>())
+  {
+    if (subSteps->count > 0)
+      return subSteps->count;
+
+    ignerr << "Requested 0 sub-steps for world [" << _world.getName()
+           << "]. Taking a single step instead.\n";
+  }
+
+  return 1;
+}
+
+/////////////////////////////////////////////////
+void SimulationFeatures::ApplyInputs(
+    const DartWorld &_world,
+    ForwardStep::State &_x,
+    const ForwardStep::Input &_u)
+{
+  // DART clears the forces and commands of every joint and body at the end of
+  // each step, so the inputs only last for the step that they are given to.
+  // Forces from several inputs for the same joint add up.
+  if (const auto *forces = _u.Query<ApplyGeneralizedForces>())
+  {
+    for (const auto &parameters : forces->forces)
+    {
+      ForEachDof(_world, this->joints, parameters,
+        [](std::size_t, dart::dynamics::Joint &_joint, std::size_t _dof,
+           double _force)
+        {
+          _joint.setForce(_dof, _joint.getForce(_dof) + _force);
+        });
+    }
+  }
+
+  if (const auto *velocities = _u.Query<VelocityControlCommands>())
+  {
+    for (const auto &parameters : velocities->commands)
+    {
+      ForEachDof(_world, this->joints, parameters,
+        [](std::size_t, dart::dynamics::Joint &_joint, std::size_t _dof,
+           double _velocity)
+        {
+          if (_joint.getActuatorType() != dart::dynamics::Joint::SERVO)
+            _joint.setActuatorType(dart::dynamics::Joint::SERVO);
+
+          _joint.setCommand(_dof, _velocity);
+        });
+    }
+  }
+
+  if (const auto *servos = _u.Query<ServoControlCommands>())
+  {
+    if (servos->commands.size() != servos->gains.size())
+    {
+      ignerr << "Given [" << servos->gains.size() << "] PID gains for ["
+             << servos->commands.size() << "] servo commands. The servo "
+             << "commands will be ignored.\n";
+    }
+    else
+    {
+      auto &integrals = _x.Get<ServoErrorIntegrals>().integrals;
+      const double dt = _world.getTimeStep();
+      for (std::size_t i = 0; i < servos->commands.size(); ++i)
+      {
+        const PIDValues &gains = servos->gains[i];
+        ForEachDof(_world, this->joints, servos->commands[i],
+          [&](std::size_t _jointID, dart::dynamics::Joint &_joint,
+              std::size_t _dof, double _target)
+          {
+            std::vector<double> &jointIntegrals = integrals[_jointID];
+            jointIntegrals.resize(_joint.getNumDofs(), 0.0);
+
+            const double error = _target - _joint.getPosition(_dof);
+            jointIntegrals[_dof] += error * dt;
+
+            const double force = gains.P * error
+                + gains.I * jointIntegrals[_dof]
+                - gains.D * _joint.getVelocity(_dof);
+            _joint.setForce(_dof, _joint.getForce(_dof) + force);
+          });
+      }
+    }
+  }
+
+  if (const auto *wrenches = _u.Query<ApplyExternalForceTorques>())
+  {
+    for (const ForceTorque &wrench : wrenches->entries)
+    {
+      const LinkInfoPtr *linkInfo = this->links.Find(wrench.body);
+      const dart::dynamics::Frame *relativeTo =
+          this->FindFrame(wrench.location.relativeTo);
+      const dart::dynamics::Frame *pointCoordinates =
+          this->FindFrame(wrench.location.inCoordinatesOf);
+      const dart::dynamics::Frame *forceCoordinates =
+          this->FindFrame(wrench.force.inCoordinatesOf);
+      const dart::dynamics::Frame *torqueCoordinates =
+          this->FindFrame(wrench.torque.inCoordinatesOf);
+
+      if (!linkInfo || !relativeTo || !pointCoordinates ||
+          !forceCoordinates || !torqueCoordinates)
+      {
+        ignerr << "Given an external force-torque for link [" << wrench.body
+               << "] which refers to an entity that does not exist. It will "
+               << "be ignored.\n";
+        continue;
+      }
+
+      dart::dynamics::BodyNode *bn = (*linkInfo)->link.get();
+      if (!InWorld(_world, *bn->getSkeleton())
+          || !InWorld(_world, *relativeTo)
+          || !InWorld(_world, *pointCoordinates)
+          || !InWorld(_world, *forceCoordinates)
+          || !InWorld(_world, *torqueCoordinates))
+      {
+        ignerr << "Given an external force-torque for link [" << wrench.body
+               << "] which refers to an entity that is not in world ["
+               << _world.getName() << "]. It will be ignored.\n";
+        continue;
+      }
+
+      const Eigen::Vector3d position =
+          relativeTo->getWorldTransform().translation()
+          + pointCoordinates->getWorldTransform().linear()
+            * math::eigen3::convert(wrench.location.point);
+
+      bn->addExtForce(
+          forceCoordinates->getWorldTransform().linear()
+            * math::eigen3::convert(wrench.force.vec),
+          position, false, false);
+      bn->addExtTorque(
+          torqueCoordinates->getWorldTransform().linear()
+            * math::eigen3::convert(wrench.torque.vec),
+          false);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+const dart::dynamics::Frame *SimulationFeatures::FindFrame(
+    const std::size_t _id) const
+{
+  if (_id == FrameID::World().ID())
+    return dart::dynamics::Frame::World();
+
+  const auto it = this->frames.find(_id);
+  return it == this->frames.end() ? nullptr : it->second;
+}
+
+/////////////////////////////////////////////////
+void SimulationFeatures::PublishSnapshot(
+    const std::size_t _worldID, const DartWorld &_world)
+{
+  const auto it = this->snapshotBuffers.find(_worldID);
+  if (it == this->snapshotBuffers.end())
+    return;
+
+  // If readers are copying every other snapshot, this step is not published
+  // rather than waiting for them.
+  WorldSnapshot *snapshot = it->second->BeginWrite();
+  if (!snapshot)
+    return;
+
+  snapshot->step = static_cast<std::size_t>(_world.getSimFrames());
+  snapshot->time = _world.getTime();
+  snapshot->links.clear();
+  snapshot->jointDofs.clear();
+  snapshot->jointPositions.clear();
+  snapshot->jointVelocities.clear();
+
+  for (std::size_t i = 0; i < _world.getNumSkeletons(); ++i)
+  {
+    const auto &skeleton = _world.getSkeleton(i);
+    for (std::size_t j = 0; j < skeleton->getNumBodyNodes(); ++j)
+    {
+      const dart::dynamics::BodyNode *bn = skeleton->getBodyNode(j);
+      const std::size_t linkID = this->links.FindIdentity(bn);
+      if (linkID == this->links.kInvalid)
+        continue;
+
+      snapshot->links.push_back({linkID, bn->getWorldTransform(),
+                                 bn->getLinearVelocity(),
+                                 bn->getAngularVelocity()});
+    }
+
+    for (std::size_t j = 0; j < skeleton->getNumJoints(); ++j)
+    {
+      const dart::dynamics::Joint *joint = skeleton->getJoint(j);
+      const std::size_t jointID = this->joints.FindIdentity(joint);
+      if (jointID == this->joints.kInvalid)
+        continue;
+
+      for (std::size_t k = 0; k < joint->getNumDofs(); ++k)
+      {
+        snapshot->jointDofs.push_back(jointID);
+        snapshot->jointPositions.push_back(joint->getPosition(k));
+        snapshot->jointVelocities.push_back(joint->getVelocity(k));
+      }
+    }
+  }
+
+  it->second->EndWrite();
+}
+
+/////////////////////////////////////////////////
+void SimulationFeatures::WriteWorldPoses(
+    const DartWorld &_world, WorldPoses &_poses) const
+{
+  _poses.entries.clear();
+  for (std::size_t i = 0; i < _world.getNumSkeletons(); ++i)
+  {
+    const auto &skeleton = _world.getSkeleton(i);
+    for (std::size_t j = 0; j < skeleton->getNumBodyNodes(); ++j)
+    {
+      const dart::dynamics::BodyNode *bn = skeleton->getBodyNode(j);
+      const std::size_t linkID = this->links.FindIdentity(bn);
+      if (linkID == this->links.kInvalid)
+        continue;
+
+      _poses.entries.push_back(
+          {math::eigen3::convert(bn->getWorldTransform()), linkID});
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void SimulationFeatures::WriteJointPositions(
+    const DartWorld &_world, JointPositions &_positions) const
+{
+  _positions.dofs.clear();
+  _positions.positions.clear();
+  for (std::size_t i = 0; i < _world.getNumSkeletons(); ++i)
+  {
+    const auto &skeleton = _world.getSkeleton(i);
+    for (std::size_t j = 0; j < skeleton->getNumJoints(); ++j)
+    {
+      const dart::dynamics::Joint *joint = skeleton->getJoint(j);
+      const std::size_t jointID = this->joints.FindIdentity(joint);
+      if (jointID == this->joints.kInvalid)
+        continue;
+
+      for (std::size_t k = 0; k < joint->getNumDofs(); ++k)
+      {
+        _positions.dofs.push_back(jointID);
+        _positions.positions.push_back(joint->getPosition(k));
+      }
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void SimulationFeatures::WriteContacts(
+    const DartWorld &_world, Contacts &_contacts) const
+{
+  _contacts.entries.clear();
+
+  const std::size_t worldFrame = FrameID::World().ID();
+  for (const auto &dtContact : _world.getLastCollisionResult().getContacts())
+  {
+    if (!this->shapes.HasEntity(
+          dtContact.collisionObject1->getShapeFrame()->asShapeNode()) ||
+        !this->shapes.HasEntity(
+          dtContact.collisionObject2->getShapeFrame()->asShapeNode()))
+    {
+      continue;
+    }
+
+    _contacts.entries.push_back(
+        {math::eigen3::convert(dtContact.point), worldFrame, worldFrame});
+  }
 }
 
 std::vector<SimulationFeatures::ContactInternal>
@@ -59,7 +495,8 @@ SimulationFeatures::GetContactsFromLastStep(const Identity &_worldID) const
 {
   std::vector<SimulationFeatures::ContactInternal> outContacts;
   auto *const world = this->ReferenceInterface<DartWorld>(_worldID);
-  const auto colResult = world->getLastCollisionResult();
+  const auto &colResult = world->getLastCollisionResult();
+  outContacts.reserve(colResult.getNumContacts());
 
   for (const auto &dtContact : colResult.getContacts())
   {
@@ -82,16 +519,168 @@ SimulationFeatures::GetContactsFromLastStep(const Identity &_worldID) const
       std::size_t shape2ID =
           this->shapes.IdentityOf(dtShapeFrame2->asShapeNode());
 
-      // TODO(addisu) Add normal, depth and wrench to extraData.
-      CompositeData extraData;
       outContacts.push_back(
-          {this->GenerateIdentity(shape1ID, this->shapes.at(shape1ID)),
-           this->GenerateIdentity(shape2ID, this->shapes.at(shape2ID)),
-           dtContact.point, extraData});
+          {this->GenerateBorrowedIdentityFromStorage(shape1ID, this->shapes),
+           this->GenerateBorrowedIdentityFromStorage(shape2ID, this->shapes),
+           dtContact.point, CompositeData()});
+
+      // Fill in the extra data where it is stored, instead of copying it
+      auto &extraContactData =
+          outContacts.back().extraData.Get<ExtraContactData>();
+      extraContactData.force = dtContact.force;
+      extraContactData.normal = dtContact.normal;
+      extraContactData.depth = dtContact.penetrationDepth;
     }
   }
   return outContacts;
 }
+
+/////////////////////////////////////////////////
+void SimulationFeatures::GetContactRecordsFromLastStep(
+    const Identity &_worldID,
+    std::vector<ContactRecord> &_contacts) const
+{
+  _contacts.clear();
+
+  auto *const world = this->ReferenceInterface<DartWorld>(_worldID);
+  const auto &colResult = world->getLastCollisionResult();
+  _contacts.reserve(colResult.getNumContacts());
+
+  for (const auto &dtContact : colResult.getContacts())
+  {
+    const std::size_t shape1ID = this->shapes.FindIdentity(
+        dtContact.collisionObject1->getShapeFrame()->asShapeNode());
+    const std::size_t shape2ID = this->shapes.FindIdentity(
+        dtContact.collisionObject2->getShapeFrame()->asShapeNode());
+
+    if (!this->shapes.HasEntity(shape1ID) || !this->shapes.HasEntity(shape2ID))
+      continue;
+
+    _contacts.push_back({shape1ID, shape2ID,
+                         dtContact.point, dtContact.normal, dtContact.force,
+                         dtContact.penetrationDepth});
+  }
+}
+
+/////////////////////////////////////////////////
+void SimulationFeatures::EngineStepWorlds(
+    const Identity &/*_engineID*/,
+    const std::vector<Identity> &_worldIDs,
+    std::vector<ForwardStep::Output> &_h,
+    std::vector<ForwardStep::State> &_x,
+    const std::vector<ForwardStep::Input> &_u)
+{
+  IGN_PROFILE("SimulationFeatures::EngineStepWorlds");
+  const std::size_t numWorlds = _worldIDs.size();
+  if (_h.size() != numWorlds || _x.size() != numWorlds ||
+      _u.size() != numWorlds)
+  {
+    ignerr << "Asked to step [" << numWorlds << "] worlds, but was given ["
+           << _h.size() << "] outputs, [" << _x.size() << "] states and ["
+           << _u.size() << "] inputs. No world will be stepped.\n";
+    return;
+  }
+
+  if (numWorlds == 0)
+    return;
+
+  // Stepping the same world from two threads would be a data race, so we
+  // refuse to do anything if a world was given more than once.
+  std::vector<std::size_t> sortedIDs(_worldIDs.begin(), _worldIDs.end());
+  std::sort(sortedIDs.begin(), sortedIDs.end());
+  if (std::adjacent_find(sortedIDs.begin(), sortedIDs.end()) !=
+      sortedIDs.end())
+  {
+    ignerr << "Asked to step a world more than once in the same call to "
+           << "StepWorlds. No world will be stepped.\n";
+    return;
+  }
+
+  std::size_t numThreads = this->stepWorldsThreadCount;
+  if (numThreads == 0)
+    numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+  // The pool keeps its threads between calls, so stepping every tick does
+  // not create any thread. ODE requires every thread that runs collision
+  // detection to allocate its own thread-local data, which is released when
+  // the thread exits.
+  if (!this->stepWorldsPool)
+  {
+    this->stepWorldsPool = std::make_unique<WorkerPool>(
+        []() { dAllocateODEDataForThread(dAllocateMaskAll); },
+        []() { dCleanupODEAllDataForThread(); });
+  }
+  this->stepWorldsPool->Resize(numThreads - 1);
+
+  // Each thread, including the calling one, keeps picking the next world that
+  // has not been stepped yet until there are none left. WorldForwardStep only
+  // touches the world it is given, and the entity maps are not modified while
+  // this function runs, so no locking is needed. An exception thrown while
+  // stepping a world is rethrown here once every thread has stopped.
+  std::atomic<std::size_t> nextWorld{0};
+  const std::function<void()> stepRemainingWorlds = [&]()
+  {
+    for (std::size_t i = nextWorld++; i < numWorlds; i = nextWorld++)
+      this->WorldForwardStep(_worldIDs[i], _h[i], _x[i], _u[i]);
+  };
+
+  this->stepWorldsPool->Run(
+      stepRemainingWorlds, std::min(numThreads, numWorlds) - 1);
+}
+
+/////////////////////////////////////////////////
+void SimulationFeatures::SetWorldSnapshotsEnabled(
+    const Identity &_worldID, const bool _enabled)
+{
+  if (!_enabled)
+  {
+    this->snapshotBuffers.erase(_worldID);
+    return;
+  }
+
+  auto &buffer = this->snapshotBuffers[_worldID];
+  if (buffer)
+    return;
+
+  buffer = std::make_unique<SnapshotBuffer<WorldSnapshot>>();
+
+  // Publish the current state right away, so that readers do not have to
+  // wait for the next step.
+  this->PublishSnapshot(
+      _worldID, *this->ReferenceInterface<DartWorld>(_worldID));
+}
+
+/////////////////////////////////////////////////
+bool SimulationFeatures::GetWorldSnapshotsEnabled(
+    const Identity &_worldID) const
+{
+  return this->snapshotBuffers.count(_worldID) > 0;
+}
+
+/////////////////////////////////////////////////
+bool SimulationFeatures::ReadWorldLatestSnapshot(
+    const Identity &_worldID, WorldSnapshot &_snapshot) const
+{
+  const auto it = this->snapshotBuffers.find(_worldID);
+  if (it == this->snapshotBuffers.end())
+    return false;
+
+  return it->second->Read(_snapshot);
+}
+
+/////////////////////////////////////////////////
+void SimulationFeatures::SetEngineStepWorldsThreadCount(
+    const Identity &/*_engineID*/, const std::size_t _count)
+{
+  this->stepWorldsThreadCount = _count;
+}
+
+/////////////////////////////////////////////////
+std::size_t SimulationFeatures::GetEngineStepWorldsThreadCount(
+    const Identity &/*_engineID*/) const
+{
+  return this->stepWorldsThreadCount;
+}
 }
 }
 }
@@ -18,11 +18,16 @@
 #ifndef IGNITION_PHYSICS_DARTSIM_SRC_SIMULATIONFEATURES_HH_
 #define IGNITION_PHYSICS_DARTSIM_SRC_SIMULATIONFEATURES_HH_
 
+#include <memory>
+#include <unordered_map>
 #include <vector>
 #include <ignition/physics/ForwardStep.hh>
 #include <ignition/physics/GetContacts.hh>
+#include <ignition/physics/WorldSnapshot.hh>
 
 #include "Base.hh"
+#include "SnapshotBuffer.hh"
+#include "WorkerPool.hh"
 
 namespace ignition {
 namespace physics {
@@ -30,7 +35,10 @@ namespace dartsim {
 
 struct SimulationFeatureList : FeatureList<
   ForwardStep,
-  GetContactsFromLastStepFeature
+  GetContactsFromLastStepFeature,
+  GetContactRecordsFromLastStepFeature,
+  StepWorldsFeature,
+  WorldSnapshotFeature
 > { };
 
 class SimulationFeatures :
@@ -45,6 +53,94 @@ class SimulationFeatures :
 
   public: std::vector<ContactInternal> GetContactsFromLastStep(
       const Identity &_worldID) const override;
+
+  public: void GetContactRecordsFromLastStep(
+      const Identity &_worldID,
+      std::vector<ContactRecord> &_contacts) const override;
+
+  public: void EngineStepWorlds(
+      const Identity &_engineID,
+      const std::vector<Identity> &_worldIDs,
+      std::vector<ForwardStep::Output> &_h,
+      std::vector<ForwardStep::State> &_x,
+      const std::vector<ForwardStep::Input> &_u) override;
+
+  public: void SetEngineStepWorldsThreadCount(
+      const Identity &_engineID, std::size_t _count) override;
+
+  public: std::size_t GetEngineStepWorldsThreadCount(
+      const Identity &_engineID) const override;
+
+  public: void SetWorldSnapshotsEnabled(
+      const Identity &_worldID, bool _enabled) override;
+
+  public: bool GetWorldSnapshotsEnabled(
+      const Identity &_worldID) const override;
+
+  public: bool ReadWorldLatestSnapshot(
+      const Identity &_worldID, WorldSnapshot &_snapshot) const override;
+
+  /// \brief Get the number of internal steps that a world takes for one
+  /// call to WorldForwardStep, as requested by the StepAccumulator or
+  /// SubSteps of _u. Without either of them, the world takes one step.
+  private: std::size_t NumInternalSteps(
+      const DartWorld &_world,
+      ForwardStep::State &_x,
+      const ForwardStep::Input &_u) const;
+
+  /// \brief Apply the commands of a ForwardStep::Input to a world before it
+  /// steps. Joints are addressed like in WriteJointPositions(), i.e. each
+  /// entry of GeneralizedParameters::dofs is the entity ID of a joint, and
+  /// repeated entries refer to its next degrees of freedom. Frames are
+  /// addressed by the entity ID of a link or shape, or by the ID of
+  /// FrameID::World(). ServoControlCommands hold the target positions of a
+  /// PID controller whose error integrals are kept in _x. Commands for
+  /// entities of another world are ignored.
+  private: void ApplyInputs(
+      const DartWorld &_world,
+      ForwardStep::State &_x,
+      const ForwardStep::Input &_u);
+
+  /// \brief Get the frame of a link or shape, or the world frame.
+  /// \return The frame, or a nullptr if no such entity exists.
+  private: const dart::dynamics::Frame *FindFrame(std::size_t _id) const;
+
+  /// \brief Copy the state of a world into its snapshot buffer, if
+  /// snapshots are enabled for it.
+  private: void PublishSnapshot(std::size_t _worldID, const DartWorld &_world);
+
+  /// \brief Write the world pose of each link of a world. WorldPose::body
+  /// is the entity ID of the link.
+  private: void WriteWorldPoses(
+      const DartWorld &_world, WorldPoses &_poses) const;
+
+  /// \brief Write the position of each degree of freedom of the joints of a
+  /// world. Each entry of JointPositions::dofs is the entity ID of the joint
+  /// that the position at the same index belongs to. Joints with several
+  /// degrees of freedom have consecutive entries, in the order of their
+  /// degrees of freedom.
+  private: void WriteJointPositions(
+      const DartWorld &_world, JointPositions &_positions) const;
+
+  /// \brief Write the contact points of the last step of a world, expressed
+  /// in the world frame.
+  private: void WriteContacts(
+      const DartWorld &_world, Contacts &_contacts) const;
+
+  /// \brief Maximum number of threads used by EngineStepWorlds. 0 means the
+  /// hardware concurrency is used.
+  private: std::size_t stepWorldsThreadCount = 0;
+
+  /// \brief Worker threads of EngineStepWorlds, started on its first call.
+  /// The calling thread also steps worlds, so there is one worker less than
+  /// the number of threads.
+  private: std::unique_ptr<WorkerPool> stepWorldsPool;
+
+  /// \brief Snapshot buffer of each world that has snapshots enabled. It is
+  /// only modified by SetWorldSnapshotsEnabled, so it can be searched from
+  /// any thread while the worlds step.
+  private: std::unordered_map<std::size_t,
+      std::unique_ptr<SnapshotBuffer<WorldSnapshot>>> snapshotBuffers;
 };
 
 }
@@ -17,8 +17,16 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
+#include <map>
+#include <new>
 #include <set>
+#include <stdexcept>
+#include <thread>
 
 #include <ignition/math/Vector3.hh>
 #include <ignition/math/eigen3/Conversions.hh>
@@ -32,7 +40,9 @@
 #include <ignition/physics/FrameSemantics.hh>
 #include <ignition/physics/GetContacts.hh>
 #include <ignition/physics/GetEntities.hh>
+#include <ignition/physics/RemoveEntities.hh>
 #include <ignition/physics/Shape.hh>
+#include <ignition/physics/WorldSnapshot.hh>
 #include <ignition/physics/sdf/ConstructWorld.hh>
 
 #include <sdf/Root.hh>
@@ -41,18 +51,49 @@
 #include <test/PhysicsPluginsList.hh>
 #include <test/Utils.hh>
 
+using ignition::physics::test::AllocationCount;
+
+/////////////////////////////////////////////////
+// Count the heap allocations of this test, so that we can check that stepping
+// a world does not allocate.
+void *operator new(std::size_t _size)
+{
+  ++ignition::physics::test::AllocationCounter();
+  if (void *memory = std::malloc(_size == 0 ? 1 : _size))
+    return memory;
+
+  throw std::bad_alloc();
+}
+
+void operator delete(void *_memory) noexcept
+{
+  std::free(_memory);
+}
+
+void operator delete(void *_memory, std::size_t) noexcept
+{
+  std::free(_memory);
+}
+
 struct TestFeatureList : ignition::physics::FeatureList<
     ignition::physics::LinkFrameSemantics,
     ignition::physics::ForwardStep,
     ignition::physics::GetContactsFromLastStepFeature,
+    ignition::physics::GetContactRecordsFromLastStepFeature,
     ignition::physics::GetEntities,
     ignition::physics::GetShapeBoundingBox,
+    ignition::physics::RemoveEntities,
+    ignition::physics::StepWorldsFeature,
+    ignition::physics::WorldSnapshotFeature,
     ignition::physics::sdf::ConstructSdfWorld
 > { };
 
+using TestEnginePtr = ignition::physics::Engine3dPtr<TestFeatureList>;
 using TestWorldPtr = ignition::physics::World3dPtr<TestFeatureList>;
 using TestShapePtr = ignition::physics::Shape3dPtr<TestFeatureList>;
 using ContactPoint = ignition::physics::World3d<TestFeatureList>::ContactPoint;
+using ExtraContactData =
+    ignition::physics::World3d<TestFeatureList>::ExtraContactData;
 
 std::unordered_set<TestWorldPtr> LoadWorlds(
     const std::string &_library,
@@ -238,7 +279,425 @@ TEST_P(SimulationFeatures_TEST, RetrieveContacts)
 
       EXPECT_TRUE(ignition::physics::test::Equal(expectedContactPos,
                                                  contactPoint.point, 1e-6));
+
+      // The spheres rest on the ground plane, which is the only shape that
+      // they touch, so the normal is vertical.
+      const auto *extraContactData = contact.Query<ExtraContactData>();
+      ASSERT_NE(nullptr, extraContactData);
+      EXPECT_NEAR(1.0, std::abs(extraContactData->normal.z()), 1e-6);
+      EXPECT_LE(0.0, extraContactData->depth);
+
+      // The contact force pushes the first body away from the second one
+      EXPECT_LE(0.0, extraContactData->force.dot(extraContactData->normal));
+    }
+
+    // The records refer to the same contacts, in the same order
+    using ContactRecord = ignition::physics::World3d<TestFeatureList>::
+        ContactRecord;
+    std::vector<ContactRecord> records;
+    world->GetContactRecordsFromLastStep(records);
+    ASSERT_EQ(contacts.size(), records.size());
+
+    const ContactRecord *buffer = records.data();
+    for (std::size_t i = 0; i < records.size(); ++i)
+    {
+      const auto &contactPoint = contacts[i].Get<ContactPoint>();
+      const ContactRecord &record = records[i];
+      EXPECT_EQ(contactPoint.collision1->EntityID(), record.collision1);
+      EXPECT_EQ(contactPoint.collision2->EntityID(), record.collision2);
+      EXPECT_TRUE(ignition::physics::test::Equal(
+          contactPoint.point, record.point, 1e-12));
+
+      // The spheres rest on the ground plane, which is the only shape that
+      // they touch, so the normal is vertical.
+      EXPECT_NEAR(1.0, std::abs(record.normal.z()), 1e-6);
+      EXPECT_LE(0.0, record.depth);
+    }
+
+    // Filling the same buffer again reuses its memory as long as it is large
+    // enough
+    world->Step(output, state, input);
+    world->GetContactRecordsFromLastStep(records);
+    EXPECT_FALSE(records.empty());
+    if (records.size() <= contacts.size())
+      EXPECT_EQ(buffer, records.data());
+  }
+}
+
+// Test that the shapes of a contact cannot be used once their model is
+// removed, since contacts refer to them with borrowed identities.
+TEST_P(SimulationFeatures_TEST, ContactShapesExpire)
+{
+  const std::string library = GetParam();
+  if (library.empty())
+    return;
+
+  auto worlds = LoadWorlds(library, TEST_WORLD_DIR "/contact.sdf");
+
+  for (const auto &world : worlds)
+  {
+    auto sphere = world->GetModel("sphere");
+    ASSERT_NE(nullptr, sphere);
+    const std::size_t sphereShapeID =
+        sphere->GetLink(0)->GetShape(0)->EntityID();
+
+    ignition::physics::ForwardStep::Input input;
+    ignition::physics::ForwardStep::State state;
+    ignition::physics::ForwardStep::Output output;
+    world->Step(output, state, input);
+
+    auto contacts = world->GetContactsFromLastStep();
+    ASSERT_FALSE(contacts.empty());
+
+    TestShapePtr sphereShape;
+    for (const auto &contact : contacts)
+    {
+      const auto &contactPoint = contact.Get<ContactPoint>();
+      if (contactPoint.collision1->EntityID() == sphereShapeID)
+        sphereShape = contactPoint.collision1;
+      else if (contactPoint.collision2->EntityID() == sphereShapeID)
+        sphereShape = contactPoint.collision2;
+    }
+    ASSERT_NE(nullptr, sphereShape);
+
+    EXPECT_TRUE(sphere->Remove());
+    EXPECT_THROW(sphereShape->GetName(), std::out_of_range);
+  }
+}
+
+// Test that a step writes the poses, joint positions and contacts of the world
+// into its output.
+TEST_P(SimulationFeatures_TEST, StepOutput)
+{
+  const std::string library = GetParam();
+  if (library.empty())
+    return;
+
+  auto worlds = LoadWorlds(library, TEST_WORLD_DIR "/contact.sdf");
+
+  for (const auto &world : worlds)
+  {
+    ignition::physics::ForwardStep::Input input;
+    ignition::physics::ForwardStep::State state;
+    ignition::physics::ForwardStep::Output output;
+
+    world->Step(output, state, input);
+
+    ASSERT_TRUE(output.Has<ignition::physics::WorldPoses>());
+    const auto &poses = output.Get<ignition::physics::WorldPoses>();
+
+    std::size_t numLinks = 0;
+    for (std::size_t i = 0; i < world->GetModelCount(); ++i)
+    {
+      const auto model = world->GetModel(i);
+      for (std::size_t j = 0; j < model->GetLinkCount(); ++j)
+      {
+        const auto link = model->GetLink(j);
+        ++numLinks;
+
+        const auto entry = std::find_if(
+            poses.entries.begin(), poses.entries.end(),
+            [&](const ignition::physics::WorldPose &_pose)
+            {
+              return _pose.body == link->EntityID();
+            });
+        ASSERT_NE(poses.entries.end(), entry);
+        EXPECT_EQ(ignition::math::eigen3::convert(
+                    link->FrameDataRelativeToWorld().pose), entry->pose);
+      }
+    }
+    EXPECT_EQ(numLinks, poses.entries.size());
+
+    ASSERT_TRUE(output.Has<ignition::physics::JointPositions>());
+    const auto &positions = output.Get<ignition::physics::JointPositions>();
+    EXPECT_EQ(positions.dofs.size(), positions.positions.size());
+
+    ASSERT_TRUE(output.Has<ignition::physics::Contacts>());
+    const auto &contacts = output.Get<ignition::physics::Contacts>();
+    const auto contactsFromLastStep = world->GetContactsFromLastStep();
+    ASSERT_EQ(contactsFromLastStep.size(), contacts.entries.size());
+    for (std::size_t i = 0; i < contacts.entries.size(); ++i)
+    {
+      EXPECT_EQ(ignition::math::eigen3::convert(
+                  contactsFromLastStep[i].Get<ContactPoint>().point),
+                contacts.entries[i].point);
+    }
+
+    // Stepping again with the same output overwrites it in place
+    const auto *posesBuffer = poses.entries.data();
+    world->Step(output, state, input);
+    EXPECT_EQ(numLinks, poses.entries.size());
+    EXPECT_EQ(posesBuffer, poses.entries.data());
+  }
+}
+
+// Test that sub-steps and accumulated time step a world exactly like the same
+// number of separate steps.
+TEST_P(SimulationFeatures_TEST, InternalSteps)
+{
+  const std::string library = GetParam();
+  if (library.empty())
+    return;
+
+  auto worlds = LoadWorlds(library, TEST_WORLD_DIR "/falling.world");
+
+  for (const auto &referenceWorld : worlds)
+  {
+    TestEnginePtr engine = referenceWorld->GetEngine();
+
+    sdf::Root root;
+    const sdf::Errors &errors = root.Load(TEST_WORLD_DIR "/falling.world");
+    ASSERT_TRUE(errors.empty());
+    auto world = engine->ConstructWorld(*root.WorldByIndex(0));
+
+    const std::chrono::steady_clock::duration timeStep =
+        std::chrono::milliseconds(1);
+    const double dt = std::chrono::duration<double>(timeStep).count();
+
+    ignition::physics::ForwardStep::Input input;
+    ignition::physics::ForwardStep::State state;
+    ignition::physics::ForwardStep::Output output;
+    input.Get<std::chrono::steady_clock::duration>() = timeStep;
+
+    ignition::physics::ForwardStep::Input referenceInput;
+    ignition::physics::ForwardStep::State referenceState;
+    ignition::physics::ForwardStep::Output referenceOutput;
+    referenceInput.Get<std::chrono::steady_clock::duration>() = timeStep;
+
+    auto link = world->GetModel(0)->GetLink(0);
+    auto referenceLink = referenceWorld->GetModel(0)->GetLink(0);
+    auto stepReference = [&](const std::size_t _numSteps)
+    {
+      for (std::size_t i = 0; i < _numSteps; ++i)
+        referenceWorld->Step(referenceOutput, referenceState, referenceInput);
+    };
+    auto expectSameState = [&]()
+    {
+      EXPECT_TRUE(ignition::physics::test::Equal(
+          referenceLink->FrameDataRelativeToWorld().pose.translation(),
+          link->FrameDataRelativeToWorld().pose.translation(), 1e-12));
+    };
+
+    input.Get<ignition::physics::SubSteps>().count = 10;
+    world->Step(output, state, input);
+    stepReference(10);
+    expectSameState();
+
+    // A request for 0 sub-steps is rejected, and a single step is taken
+    input.Get<ignition::physics::SubSteps>().count = 0;
+    world->Step(output, state, input);
+    stepReference(1);
+    expectSameState();
+    input.Remove<ignition::physics::SubSteps>();
+
+    // Sub-steps are ignored while accumulating time. Only two whole steps fit
+    // into the first call, and the half step that is left over is completed
+    // by the second one.
+    input.Get<ignition::physics::SubSteps>().count = 10;
+    auto &accumulator = input.Get<ignition::physics::StepAccumulator>();
+    accumulator.elapsed = 2.5 * dt;
+    accumulator.maxSteps = 0;
+    world->Step(output, state, input);
+    stepReference(2);
+    expectSameState();
+
+    accumulator.elapsed = 0.5 * dt;
+    world->Step(output, state, input);
+    stepReference(1);
+    expectSameState();
+
+    // Time beyond the step limit is dropped
+    accumulator.elapsed = 100.0 * dt;
+    accumulator.maxSteps = 5;
+    world->Step(output, state, input);
+    stepReference(5);
+    expectSameState();
+
+    accumulator.elapsed = 0.0;
+    world->Step(output, state, input);
+    expectSameState();
+  }
+}
+
+// Test that stepping a world with the same Output, State and Input every step
+// does not allocate once their data has been created.
+TEST_P(SimulationFeatures_TEST, StepWithoutAllocating)
+{
+  const std::string library = GetParam();
+  if (library.empty())
+    return;
+
+  auto worlds = LoadWorlds(library, TEST_WORLD_DIR "/falling.world");
+
+  for (const auto &world : worlds)
+  {
+    ignition::physics::ForwardStep::Input input;
+    ignition::physics::ForwardStep::State state;
+    ignition::physics::ForwardStep::Output output;
+    input.Get<std::chrono::steady_clock::duration>() =
+        std::chrono::milliseconds(1);
+
+    // Warm up, so that the Output has created its data and the vectors inside
+    // of it have grown to the size of the world
+    for (std::size_t i = 0; i < 10; ++i)
+      world->Step(output, state, input);
+
+    // The sphere needs about 450 steps to reach the box, so there are no
+    // contacts for the engine to allocate during these steps.
+    const std::size_t warmCount = AllocationCount();
+    for (std::size_t i = 0; i < 100; ++i)
+      world->Step(output, state, input);
+
+    EXPECT_EQ(warmCount, AllocationCount());
+    ASSERT_TRUE(output.Has<ignition::physics::WorldPoses>());
+    EXPECT_FALSE(
+        output.Get<ignition::physics::WorldPoses>().entries.empty());
+  }
+}
+
+// Test that stepping several worlds concurrently gives the same result as
+// stepping them one at a time.
+TEST_P(SimulationFeatures_TEST, StepWorlds)
+{
+  const std::string library = GetParam();
+  if (library.empty())
+    return;
+
+  auto worlds = LoadWorlds(library, TEST_WORLD_DIR "/falling.world");
+
+  for (const auto &referenceWorld : worlds)
+  {
+    TestEnginePtr engine = referenceWorld->GetEngine();
+
+    sdf::Root root;
+    const sdf::Errors &errors = root.Load(TEST_WORLD_DIR "/falling.world");
+    ASSERT_TRUE(errors.empty());
+
+    const std::size_t numWorlds = 4;
+    std::vector<TestWorldPtr> parallelWorlds;
+    for (std::size_t i = 0; i < numWorlds; ++i)
+      parallelWorlds.push_back(engine->ConstructWorld(*root.WorldByIndex(0)));
+
+    engine->SetStepWorldsThreadCount(2);
+    EXPECT_EQ(2u, engine->GetStepWorldsThreadCount());
+
+    std::vector<ignition::physics::ForwardStep::Input> inputs(numWorlds);
+    std::vector<ignition::physics::ForwardStep::State> states(numWorlds);
+    std::vector<ignition::physics::ForwardStep::Output> outputs(numWorlds);
+
+    ignition::physics::ForwardStep::Input input;
+    ignition::physics::ForwardStep::State state;
+    ignition::physics::ForwardStep::Output output;
+
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+      engine->StepWorlds(parallelWorlds, outputs, states, inputs);
+      referenceWorld->Step(output, state, input);
     }
+
+    const Eigen::Vector3d referencePos = referenceWorld->GetModel(0)->GetLink(0)
+        ->FrameDataRelativeToWorld().pose.translation();
+
+    for (const auto &world : parallelWorlds)
+    {
+      const Eigen::Vector3d pos = world->GetModel(0)->GetLink(0)
+          ->FrameDataRelativeToWorld().pose.translation();
+      EXPECT_TRUE(ignition::physics::test::Equal(referencePos, pos, 1e-10));
+    }
+
+    // Giving the same world twice is refused, so nothing gets stepped
+    inputs.resize(2);
+    states.resize(2);
+    outputs.resize(2);
+    const Eigen::Vector3d before = parallelWorlds[0]->GetModel(0)->GetLink(0)
+        ->FrameDataRelativeToWorld().pose.translation();
+    engine->StepWorlds({parallelWorlds[0], parallelWorlds[0]},
+                       outputs, states, inputs);
+    const Eigen::Vector3d after = parallelWorlds[0]->GetModel(0)->GetLink(0)
+        ->FrameDataRelativeToWorld().pose.translation();
+    EXPECT_TRUE(ignition::physics::test::Equal(before, after, 0.0));
+  }
+}
+
+// Test that the published snapshots match the state of the world, and that
+// they can be read while the world steps.
+TEST_P(SimulationFeatures_TEST, Snapshots)
+{
+  const std::string library = GetParam();
+  if (library.empty())
+    return;
+
+  auto worlds = LoadWorlds(library, TEST_WORLD_DIR "/falling.world");
+
+  for (const auto &world : worlds)
+  {
+    using WorldSnapshot =
+        ignition::physics::World3d<TestFeatureList>::WorldSnapshot;
+
+    WorldSnapshot snapshot;
+    EXPECT_FALSE(world->GetSnapshotsEnabled());
+    EXPECT_FALSE(world->ReadLatestSnapshot(snapshot));
+
+    world->SetSnapshotsEnabled(true);
+    EXPECT_TRUE(world->GetSnapshotsEnabled());
+
+    // The state at the time of enabling is published right away
+    ASSERT_TRUE(world->ReadLatestSnapshot(snapshot));
+    EXPECT_EQ(0u, snapshot.step);
+
+    ignition::physics::ForwardStep::Input input;
+    ignition::physics::ForwardStep::State state;
+    ignition::physics::ForwardStep::Output output;
+
+    std::atomic<bool> done{false};
+    std::size_t numInconsistent = 0;
+    std::thread reader([&]()
+    {
+      WorldSnapshot readSnapshot;
+      while (!done)
+      {
+        if (!world->ReadLatestSnapshot(readSnapshot))
+          continue;
+
+        if (readSnapshot.jointDofs.size() != readSnapshot.jointPositions.size()
+            || readSnapshot.jointDofs.size()
+               != readSnapshot.jointVelocities.size())
+        {
+          ++numInconsistent;
+        }
+      }
+    });
+
+    for (std::size_t i = 0; i < 100; ++i)
+      world->Step(output, state, input);
+
+    done = true;
+    reader.join();
+    EXPECT_EQ(0u, numInconsistent);
+
+    ASSERT_TRUE(world->ReadLatestSnapshot(snapshot));
+    EXPECT_EQ(100u, snapshot.step);
+    EXPECT_LT(0.0, snapshot.time);
+
+    auto link = world->GetModel(0)->GetLink(0);
+    const auto linkState = std::find_if(
+        snapshot.links.begin(), snapshot.links.end(),
+        [&](const WorldSnapshot::LinkState &_state)
+        {
+          return _state.link == link->EntityID();
+        });
+    ASSERT_NE(snapshot.links.end(), linkState);
+
+    const auto frameData = link->FrameDataRelativeToWorld();
+    EXPECT_TRUE(ignition::physics::test::Equal(
+        frameData.pose.translation(), linkState->pose.translation(), 1e-10));
+    EXPECT_TRUE(ignition::physics::test::Equal(
+        frameData.linearVelocity, linkState->linearVelocity, 1e-10));
+
+    // Disabling releases the snapshots
+    world->SetSnapshotsEnabled(false);
+    EXPECT_FALSE(world->GetSnapshotsEnabled());
+    EXPECT_FALSE(world->ReadLatestSnapshot(snapshot));
   }
 }
 
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_DARTSIM_SRC_SNAPSHOTBUFFER_HH_
+#define IGNITION_PHYSICS_DARTSIM_SRC_SNAPSHOTBUFFER_HH_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+/// \brief Passes copies of a value from one writer thread to any number of
+/// reader threads without locks.
+///
+/// The writer fills a slot that nobody is reading and then publishes it as
+/// the latest one. A reader announces that it is using the latest slot by
+/// incrementing the reader count of that slot, and only copies it if the
+/// slot is still the latest one afterwards. The writer never picks a slot
+/// that is the latest one or that has readers, so a slot is never written
+/// while it is being copied.
+///
+/// The writer needs one free slot besides the latest one. If readers are
+/// copying every other slot, BeginWrite() returns a nullptr and the writer
+/// has to skip that value, so it never waits for the readers. With NumSlots
+/// slots, that can only happen while more than NumSlots - 2 readers copy at
+/// the same time.
+template <typename T, std::size_t NumSlots = 4>
+class SnapshotBuffer
+{
+  static_assert(NumSlots >= 2, "SnapshotBuffer needs at least two slots");
+
+  /// \brief Get a slot to write the next value into. Only the writer thread
+  /// may call this.
+  /// \return The slot, which holds an older value, or a nullptr if every
+  /// slot is in use.
+  public: T *BeginWrite()
+  {
+    const std::size_t latestSlot = this->latest.load();
+    for (std::size_t i = 0; i < NumSlots; ++i)
+    {
+      if (i != latestSlot && this->slots[i].readers.load() == 0)
+      {
+        this->writing = i;
+        return &this->slots[i].value;
+      }
+    }
+
+    return nullptr;
+  }
+
+  /// \brief Publish the slot of the last call to BeginWrite() as the latest
+  /// value. Only the writer thread may call this.
+  public: void EndWrite()
+  {
+    if (this->writing != kNone)
+      this->latest.store(this->writing);
+
+    this->writing = kNone;
+  }
+
+  /// \brief Copy the latest value. Any thread may call this at any time.
+  /// \param[out] _value
+  ///   Assigned the latest value
+  /// \return True if a value was copied, false if none was published yet.
+  public: bool Read(T &_value) const
+  {
+    while (true)
+    {
+      const std::size_t index = this->latest.load();
+      if (index == kNone)
+        return false;
+
+      const Slot &slot = this->slots[index];
+      ++slot.readers;
+
+      // If the writer published a different slot before we announced
+      // ourselves, it may already be writing into this one.
+      if (this->latest.load() == index)
+      {
+        _value = slot.value;
+        --slot.readers;
+        return true;
+      }
+
+      --slot.readers;
+    }
+  }
+
+  /// \brief Marks the absence of a slot
+  private: static constexpr std::size_t kNone =
+      std::numeric_limits<std::size_t>::max();
+
+  /// \brief A value and the number of readers that are copying it
+  private: struct Slot
+  {
+    T value;
+    mutable std::atomic<std::size_t> readers{0};
+  };
+
+  /// \brief The values
+  private: std::array<Slot, NumSlots> slots;
+
+  /// \brief Index of the slot which was published last
+  private: std::atomic<std::size_t> latest{kNone};
+
+  /// \brief Index of the slot that the writer is filling
+  private: std::size_t writing = kNone;
+};
+
+}
+}
+}
+
+#endif
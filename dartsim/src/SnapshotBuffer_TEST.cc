@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "SnapshotBuffer.hh"
+
+using ignition::physics::dartsim::SnapshotBuffer;
+
+/////////////////////////////////////////////////
+TEST(SnapshotBuffer, PublishAndRead)
+{
+  SnapshotBuffer<int, 2> buffer;
+
+  int value = -1;
+  EXPECT_FALSE(buffer.Read(value));
+  EXPECT_EQ(-1, value);
+
+  int *slot = buffer.BeginWrite();
+  ASSERT_NE(nullptr, slot);
+  *slot = 1;
+
+  // Nothing is published until the write ends
+  EXPECT_FALSE(buffer.Read(value));
+  buffer.EndWrite();
+  EXPECT_TRUE(buffer.Read(value));
+  EXPECT_EQ(1, value);
+
+  // The latest value is never handed out for writing
+  int *nextSlot = buffer.BeginWrite();
+  ASSERT_NE(nullptr, nextSlot);
+  EXPECT_NE(slot, nextSlot);
+  *nextSlot = 2;
+
+  EXPECT_TRUE(buffer.Read(value));
+  EXPECT_EQ(1, value);
+  buffer.EndWrite();
+  EXPECT_TRUE(buffer.Read(value));
+  EXPECT_EQ(2, value);
+}
+
+/////////////////////////////////////////////////
+TEST(SnapshotBuffer, ConcurrentReaders)
+{
+  // Every element of a snapshot holds the number of the write that produced
+  // it, so a reader can tell if it ever sees a snapshot that is being written.
+  using Snapshot = std::vector<std::size_t>;
+  const std::size_t snapshotSize = 256;
+  const std::size_t numWrites = 20000;
+  const std::size_t numReaders = 4;
+
+  SnapshotBuffer<Snapshot> buffer;
+  std::atomic<bool> done{false};
+  std::atomic<std::size_t> numSkipped{0};
+
+  std::vector<std::thread> readers;
+  std::vector<std::size_t> numTorn(numReaders, 0);
+  std::vector<std::size_t> numOutOfOrder(numReaders, 0);
+  for (std::size_t r = 0; r < numReaders; ++r)
+  {
+    readers.emplace_back([&, r]()
+    {
+      Snapshot snapshot;
+      std::size_t last = 0;
+      while (!done)
+      {
+        if (!buffer.Read(snapshot))
+          continue;
+
+        if (snapshot.size() != snapshotSize)
+        {
+          ++numTorn[r];
+          continue;
+        }
+
+        for (const std::size_t element : snapshot)
+        {
+          if (element != snapshot.front())
+          {
+            ++numTorn[r];
+            break;
+          }
+        }
+
+        if (snapshot.front() < last)
+          ++numOutOfOrder[r];
+        last = snapshot.front();
+      }
+    });
+  }
+
+  for (std::size_t i = 1; i <= numWrites; ++i)
+  {
+    Snapshot *slot = buffer.BeginWrite();
+    if (!slot)
+    {
+      ++numSkipped;
+      continue;
+    }
+
+    slot->assign(snapshotSize, i);
+    buffer.EndWrite();
+  }
+
+  done = true;
+  for (auto &reader : readers)
+    reader.join();
+
+  for (std::size_t r = 0; r < numReaders; ++r)
+  {
+    EXPECT_EQ(0u, numTorn[r]);
+    EXPECT_EQ(0u, numOutOfOrder[r]);
+  }
+
+  // Skipping is allowed, but it must not happen all the time
+  EXPECT_LT(numSkipped, numWrites);
+
+  Snapshot snapshot;
+  ASSERT_TRUE(buffer.Read(snapshot));
+  ASSERT_EQ(snapshotSize, snapshot.size());
+  EXPECT_LT(0u, snapshot.front());
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_DARTSIM_SRC_WORKERPOOL_HH_
+#define IGNITION_PHYSICS_DARTSIM_SRC_WORKERPOOL_HH_
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+/// \brief A set of threads that are kept alive to run the same job together
+/// with the calling thread, so that running a job does not create threads.
+///
+/// Only one thread may use a pool at a time.
+class WorkerPool
+{
+  /// \brief Constructor. No threads are started until Resize() is called.
+  /// \param[in] _threadStart
+  ///   Called by every worker thread when it starts, e.g. to allocate
+  ///   thread-local data of a library
+  /// \param[in] _threadExit
+  ///   Called by every worker thread right before it exits
+  public: explicit WorkerPool(
+      std::function<void()> _threadStart = nullptr,
+      std::function<void()> _threadExit = nullptr)
+    : threadStart(std::move(_threadStart)),
+      threadExit(std::move(_threadExit))
+  {
+    // Do nothing
+  }
+
+  /// \brief Destructor. Stops and joins every worker thread.
+  public: ~WorkerPool()
+  {
+    this->Stop();
+  }
+
+  /// \brief Start or stop worker threads until there are _numWorkers of
+  /// them. Nothing happens if the pool already has that many.
+  public: void Resize(const std::size_t _numWorkers)
+  {
+    if (this->workers.size() == _numWorkers)
+      return;
+
+    // Workers know their index, so the pool is rebuilt from scratch
+    this->Stop();
+
+    this->workers.reserve(_numWorkers);
+    for (std::size_t i = 0; i < _numWorkers; ++i)
+      this->workers.emplace_back(&WorkerPool::Work, this, i, this->generation);
+  }
+
+  /// \brief Get the number of worker threads
+  public: std::size_t Size() const
+  {
+    return this->workers.size();
+  }
+
+  /// \brief Run _job on _numWorkers worker threads and on the calling thread
+  /// at the same time, and wait until every one of them has returned.
+  /// \param[in] _job
+  ///   The job. It is up to the job to split its work between the threads.
+  /// \param[in] _numWorkers
+  ///   Number of worker threads to use, which is capped to Size().
+  /// \throws The first exception thrown by _job on any of the threads, once
+  /// every thread has returned.
+  public: void Run(
+      const std::function<void()> &_job, const std::size_t _numWorkers)
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->job = &_job;
+      this->numParticipants = std::min(_numWorkers, this->workers.size());
+      this->numRunning = this->numParticipants;
+      this->error = nullptr;
+      ++this->generation;
+    }
+    this->wake.notify_all();
+
+    this->RunJob(_job);
+
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->done.wait(lock, [this]() { return this->numRunning == 0; });
+    this->job = nullptr;
+
+    if (this->error)
+    {
+      std::exception_ptr currentError = std::move(this->error);
+      this->error = nullptr;
+      std::rethrow_exception(currentError);
+    }
+  }
+
+  /// \brief The loop of a worker thread
+  private: void Work(const std::size_t _index, std::size_t _generation)
+  {
+    if (this->threadStart)
+      this->threadStart();
+
+    std::unique_lock<std::mutex> lock(this->mutex);
+    while (true)
+    {
+      this->wake.wait(lock, [&]()
+      {
+        return this->stopping || this->generation != _generation;
+      });
+
+      if (this->stopping)
+        break;
+
+      // Run() does not start another job before every participant of this
+      // one has finished it, so a participant never misses a job.
+      _generation = this->generation;
+      if (_index >= this->numParticipants)
+        continue;
+
+      const std::function<void()> &currentJob = *this->job;
+      lock.unlock();
+      this->RunJob(currentJob);
+      lock.lock();
+
+      if (--this->numRunning == 0)
+        this->done.notify_one();
+    }
+    lock.unlock();
+
+    if (this->threadExit)
+      this->threadExit();
+  }
+
+  /// \brief Run the current job, storing the exception it throws, if any
+  private: void RunJob(const std::function<void()> &_job)
+  {
+    try
+    {
+      _job();
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      if (!this->error)
+        this->error = std::current_exception();
+    }
+  }
+
+  /// \brief Stop and join every worker thread
+  private: void Stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->stopping = true;
+    }
+    this->wake.notify_all();
+
+    for (auto &worker : this->workers)
+      worker.join();
+
+    this->workers.clear();
+    this->stopping = false;
+  }
+
+  private: std::function<void()> threadStart;
+
+  private: std::function<void()> threadExit;
+
+  private: std::vector<std::thread> workers;
+
+  /// \brief Protects every field below
+  private: std::mutex mutex;
+
+  /// \brief Notifies the workers of a new job or that they must stop
+  private: std::condition_variable wake;
+
+  /// \brief Notifies Run() that the last worker finished its job
+  private: std::condition_variable done;
+
+  /// \brief Incremented for every job
+  private: std::size_t generation = 0;
+
+  /// \brief The job being run, if any
+  private: const std::function<void()> *job = nullptr;
+
+  /// \brief Number of workers which take part in the current job
+  private: std::size_t numParticipants = 0;
+
+  /// \brief Number of workers which have not finished the current job yet
+  private: std::size_t numRunning = 0;
+
+  /// \brief First exception thrown by the current job
+  private: std::exception_ptr error;
+
+  /// \brief True while the workers are being stopped
+  private: bool stopping = false;
+};
+
+}
+}
+}
+
+#endif
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+#include "WorkerPool.hh"
+
+using ignition::physics::dartsim::WorkerPool;
+
+/////////////////////////////////////////////////
+TEST(WorkerPool, RunsOnPersistentThreads)
+{
+  std::atomic<std::size_t> numStarted{0};
+  std::atomic<std::size_t> numExited{0};
+  {
+    WorkerPool pool([&]() { ++numStarted; }, [&]() { ++numExited; });
+    pool.Resize(3);
+    EXPECT_EQ(3u, pool.Size());
+
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    std::atomic<std::size_t> numCalls{0};
+    const std::function<void()> job = [&]()
+    {
+      ++numCalls;
+      std::lock_guard<std::mutex> lock(mutex);
+      threads.insert(std::this_thread::get_id());
+    };
+
+    for (std::size_t i = 0; i < 100; ++i)
+      pool.Run(job, 3);
+
+    // Every call runs on the three workers and the calling thread, and no
+    // thread is created after Resize
+    EXPECT_EQ(400u, numCalls);
+    EXPECT_EQ(4u, threads.size());
+    EXPECT_EQ(3u, numStarted);
+
+    // Resizing to the same size keeps the threads
+    pool.Resize(3);
+    EXPECT_EQ(3u, numStarted);
+    EXPECT_EQ(0u, numExited);
+
+    numCalls = 0;
+    pool.Run(job, 1);
+    EXPECT_EQ(2u, numCalls);
+
+    numCalls = 0;
+    pool.Run(job, 10);
+    EXPECT_EQ(4u, numCalls);
+  }
+
+  EXPECT_EQ(3u, numExited);
+}
+
+/////////////////////////////////////////////////
+TEST(WorkerPool, RethrowsOnCallingThread)
+{
+  WorkerPool pool;
+  pool.Resize(2);
+
+  const std::thread::id caller = std::this_thread::get_id();
+  std::atomic<std::size_t> numCalls{0};
+  const std::function<void()> job = [&]()
+  {
+    ++numCalls;
+    if (std::this_thread::get_id() != caller)
+      throw std::out_of_range("worker failed");
+  };
+
+  EXPECT_THROW(pool.Run(job, 2), std::out_of_range);
+  EXPECT_EQ(3u, numCalls);
+
+  // The pool can still be used after an exception
+  numCalls = 0;
+  const std::function<void()> count = [&]() { ++numCalls; };
+  EXPECT_NO_THROW(pool.Run(count, 2));
+  EXPECT_EQ(3u, numCalls);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <dart/collision/CollisionDetector.hpp>
+#include <dart/constraint/ConstraintSolver.hpp>
+#include <dart/dynamics/ShapeNode.hpp>
+
+#include <string>
+#include <vector>
+
+#include "WorldFeatures.hh"
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+/////////////////////////////////////////////////
+bool WorldFeatures::SetWorldCollisionDetector(
+    const Identity &_worldID, const std::string &_collisionDetector)
+{
+  auto *const world = this->ReferenceInterface<DartWorld>(_worldID);
+  auto *const solver = world->getConstraintSolver();
+
+  if (solver->getCollisionDetector()->getType() == _collisionDetector)
+    return true;
+
+  // Collision detectors register themselves with this factory when the library
+  // that provides them is loaded. "fcl" and "dart" are part of the core dartsim
+  // library, and "ode" is always linked into this plugin.
+  auto detector =
+      dart::collision::CollisionDetector::getFactory()->create(
+        _collisionDetector);
+
+  if (!detector)
+  {
+    ignerr << "Collision detector [" << _collisionDetector << "] is not "
+           << "available. World [" << world->getName() << "] keeps using ["
+           << solver->getCollisionDetector()->getType() << "].\n";
+    return false;
+  }
+
+  // The constraint solver fills the collision group of the new detector with
+  // the shapes of every skeleton in the world.
+  solver->setCollisionDetector(detector);
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+const std::string &WorldFeatures::GetWorldCollisionDetector(
+    const Identity &_worldID) const
+{
+  return this->ReferenceInterface<DartWorld>(_worldID)
+      ->getConstraintSolver()->getCollisionDetector()->getType();
+}
+
+/////////////////////////////////////////////////
+void WorldFeatures::SetWorldMaxContacts(
+    const Identity &_worldID, const std::size_t _maxContacts)
+{
+  this->ReferenceInterface<DartWorld>(_worldID)
+      ->getConstraintSolver()->getCollisionOption().maxNumContacts =
+          _maxContacts;
+}
+
+/////////////////////////////////////////////////
+std::size_t WorldFeatures::GetWorldMaxContacts(
+    const Identity &_worldID) const
+{
+  return this->ReferenceInterface<DartWorld>(_worldID)
+      ->getConstraintSolver()->getCollisionOption().maxNumContacts;
+}
+
+/////////////////////////////////////////////////
+Identity WorldFeatures::CloneWorld(
+    const Identity &_worldID, const std::string &_name)
+{
+  // Copy the pointers of the source, because adding entities may move the
+  // entries of the storages.
+  const DartWorldPtr source = this->worlds.at(_worldID);
+  if (this->worlds.HasEntity(_name))
+  {
+    ignerr << "Cannot clone world [" << source->getName() << "] as ["
+           << _name << "], because a world with that name already exists.\n";
+    return this->GenerateInvalidId();
+  }
+
+  auto world = std::make_shared<dart::simulation::World>(_name);
+  world->setGravity(source->getGravity());
+  world->setTimeStep(source->getTimeStep());
+  world->setTime(source->getTime());
+
+  auto *const sourceSolver = source->getConstraintSolver();
+  auto *const solver = world->getConstraintSolver();
+  solver->setCollisionDetector(
+      sourceSolver->getCollisionDetector()->cloneWithoutCollisionObjects());
+
+  // This also shares the collision filter, which does not keep any state of
+  // the world that it is used by.
+  solver->getCollisionOption() = sourceSolver->getCollisionOption();
+
+  const std::size_t worldID = this->AddWorld(world, _name);
+  auto &sources = this->cloneSources[worldID];
+  sources[worldID] = _worldID;
+
+  std::vector<ModelInfoPtr> sourceModels;
+  sourceModels.reserve(this->models.ContainerSize(_worldID));
+  for (std::size_t i = 0; i < this->models.ContainerSize(_worldID); ++i)
+  {
+    sourceModels.push_back(
+        this->models.at(this->models.IdInContainer(_worldID, i)));
+  }
+
+  for (const ModelInfoPtr &sourceInfo : sourceModels)
+  {
+    const DartSkeletonPtr &sourceModel = sourceInfo->model;
+
+    // The clone has the same BodyNodes in the same order as the source, each
+    // with the same ShapeNodes in the same order, and the same state.
+    ModelInfo info;
+    info.model = sourceModel->cloneSkeleton(sourceModel->getName());
+    info.canonicalLinkName = sourceInfo->canonicalLinkName;
+
+    const auto *canonicalLink = dynamic_cast<const DartBodyNode*>(
+        sourceInfo->frame->getParentFrame());
+    info.frame = dart::dynamics::SimpleFrame::createShared(
+        canonicalLink
+          ? info.model->getBodyNode(canonicalLink->getIndexInSkeleton())
+          : dart::dynamics::Frame::World(),
+        sourceInfo->frame->getName(),
+        sourceInfo->frame->getRelativeTransform());
+
+    auto [modelID, modelInfo] = this->AddModel(info, worldID);  // NOLINT
+    sources[modelID] = this->models.IdentityOf(sourceModel);
+
+    for (std::size_t i = 0; i < sourceModel->getNumBodyNodes(); ++i)
+    {
+      DartBodyNode *sourceBn = sourceModel->getBodyNode(i);
+      DartBodyNode *bn = info.model->getBodyNode(i);
+
+      const std::size_t sourceLinkID = this->links.FindIdentity(sourceBn);
+      if (sourceLinkID != this->links.kInvalid)
+        sources[this->AddLink(bn)] = sourceLinkID;
+
+      const std::size_t sourceJointID =
+          this->joints.FindIdentity(sourceBn->getParentJoint());
+      if (sourceJointID != this->joints.kInvalid)
+        sources[this->AddJoint(bn->getParentJoint())] = sourceJointID;
+
+      for (std::size_t j = 0; j < sourceBn->getNumShapeNodes(); ++j)
+      {
+        const std::size_t sourceShapeID =
+            this->shapes.FindIdentity(sourceBn->getShapeNode(j));
+        if (sourceShapeID == this->shapes.kInvalid)
+          continue;
+
+        ShapeInfo shape = *this->shapes.at(sourceShapeID);
+        shape.node = bn->getShapeNode(j);
+        sources[this->AddShape(shape)] = sourceShapeID;
+      }
+    }
+
+    // The skeleton was complete when it was added to the world, so it does
+    // not need to be registered again.
+    modelInfo.registrationPending = false;
+  }
+  this->pendingSkeletons.erase(worldID);
+
+  return this->GenerateIdentity(worldID, this->worlds.at(worldID));
+}
+
+/////////////////////////////////////////////////
+std::size_t WorldFeatures::GetWorldCloneSourceID(
+    const Identity &_worldID, const std::size_t _entityID) const
+{
+  const auto world = this->cloneSources.find(_worldID);
+  if (world == this->cloneSources.end())
+    return INVALID_ENTITY_ID;
+
+  const auto entity = world->second.find(_entityID);
+  if (entity == world->second.end())
+    return INVALID_ENTITY_ID;
+
+  return entity->second;
+}
+
+}
+}
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_DARTSIM_SRC_WORLDFEATURES_HH_
+#define IGNITION_PHYSICS_DARTSIM_SRC_WORLDFEATURES_HH_
+
+#include <string>
+#include <unordered_map>
+
+#include <ignition/physics/World.hh>
+
+#include "Base.hh"
+
+namespace ignition {
+namespace physics {
+namespace dartsim {
+
+struct WorldFeatureList : FeatureList<
+  CloneWorld,
+  CollisionDetector,
+  WorldMaxContacts
+> { };
+
+class WorldFeatures :
+    public virtual Base,
+    public virtual Implements3d<WorldFeatureList>
+{
+  // ----- CollisionDetector -----
+  public: bool SetWorldCollisionDetector(
+      const Identity &_worldID,
+      const std::string &_collisionDetector) override;
+
+  public: const std::string &GetWorldCollisionDetector(
+      const Identity &_worldID) const override;
+
+  // ----- WorldMaxContacts -----
+  public: void SetWorldMaxContacts(
+      const Identity &_worldID, std::size_t _maxContacts) override;
+
+  public: std::size_t GetWorldMaxContacts(
+      const Identity &_worldID) const override;
+
+  // ----- CloneWorld -----
+  public: Identity CloneWorld(
+      const Identity &_worldID, const std::string &_name) override;
+
+  public: std::size_t GetWorldCloneSourceID(
+      const Identity &_worldID, std::size_t _entityID) const override;
+
+  /// \brief Map from the ID of a cloned world to a map from the ID of each
+  /// entity that was copied into that world to the ID of its source entity
+  private: std::unordered_map<std::size_t,
+      std::unordered_map<std::size_t, std::size_t>> cloneSources;
+};
+
+}
+}
+}
+
+#endif
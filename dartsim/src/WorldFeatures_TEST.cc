@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <ignition/plugin/Loader.hh>
+
+#include <ignition/physics/RequestEngine.hh>
+
+// Features
+#include <ignition/physics/ForwardStep.hh>
+#include <ignition/physics/FrameSemantics.hh>
+#include <ignition/physics/GetEntities.hh>
+#include <ignition/physics/World.hh>
+#include <ignition/physics/sdf/ConstructWorld.hh>
+
+#include <sdf/Root.hh>
+#include <sdf/World.hh>
+
+using namespace ignition;
+
+using TestFeatureList = ignition::physics::FeatureList<
+  physics::CloneWorld,
+  physics::CollisionDetector,
+  physics::ForwardStep,
+  physics::GetEntities,
+  physics::LinkFrameSemantics,
+  physics::WorldMaxContacts,
+  physics::sdf::ConstructSdfWorld
+>;
+
+using TestWorldPtr = physics::World3dPtr<TestFeatureList>;
+
+/////////////////////////////////////////////////
+TestWorldPtr LoadFallingWorld()
+{
+  ignition::plugin::Loader loader;
+  loader.LoadLib(dartsim_plugin_LIB);
+
+  ignition::plugin::PluginPtr dartsim =
+      loader.Instantiate("ignition::physics::dartsim::Plugin");
+
+  auto engine =
+      ignition::physics::RequestEngine3d<TestFeatureList>::From(dartsim);
+  if (!engine)
+    return nullptr;
+
+  sdf::Root root;
+  const sdf::Errors errors = root.Load(TEST_WORLD_DIR "falling.world");
+  if (!errors.empty())
+    return nullptr;
+
+  return engine->ConstructWorld(*root.WorldByIndex(0));
+}
+
+/////////////////////////////////////////////////
+TEST(WorldFeatures, CollisionDetector)
+{
+  auto world = LoadFallingWorld();
+  ASSERT_NE(nullptr, world);
+
+  EXPECT_EQ("ode", world->GetCollisionDetector());
+
+  EXPECT_TRUE(world->SetCollisionDetector("fcl"));
+  EXPECT_EQ("fcl", world->GetCollisionDetector());
+
+  // An unknown detector leaves the current one in place
+  EXPECT_FALSE(world->SetCollisionDetector("no_such_detector"));
+  EXPECT_EQ("fcl", world->GetCollisionDetector());
+
+  // The shapes that were already in the world must be picked up by the new
+  // detector, otherwise the sphere would fall through the ground.
+  EXPECT_TRUE(world->SetCollisionDetector("dart"));
+  EXPECT_EQ("dart", world->GetCollisionDetector());
+
+  physics::ForwardStep::Input input;
+  physics::ForwardStep::State state;
+  physics::ForwardStep::Output output;
+  for (std::size_t i = 0; i < 1000; ++i)
+    world->Step(output, state, input);
+
+  auto link = world->GetModel("sphere")->GetLink(0);
+  const auto pos = link->FrameDataRelativeToWorld().pose.translation();
+  EXPECT_NEAR(1.0, pos.z(), 5e-2);
+}
+
+/////////////////////////////////////////////////
+TEST(WorldFeatures, MaxContacts)
+{
+  auto world = LoadFallingWorld();
+  ASSERT_NE(nullptr, world);
+
+  EXPECT_EQ(10000u, world->GetMaxContacts());
+
+  world->SetMaxContacts(5u);
+  EXPECT_EQ(5u, world->GetMaxContacts());
+
+  // The limit survives a change of collision detector
+  EXPECT_TRUE(world->SetCollisionDetector("fcl"));
+  EXPECT_EQ(5u, world->GetMaxContacts());
+}
+
+/////////////////////////////////////////////////
+TEST(WorldFeatures, CloneWorld)
+{
+  auto world = LoadFallingWorld();
+  ASSERT_NE(nullptr, world);
+
+  physics::ForwardStep::Input input;
+  physics::ForwardStep::State state;
+  physics::ForwardStep::Output output;
+  for (std::size_t i = 0; i < 100; ++i)
+    world->Step(output, state, input);
+
+  world->SetMaxContacts(5u);
+  auto clone = world->Clone("clone");
+  ASSERT_NE(nullptr, clone);
+  EXPECT_EQ("clone", clone->GetName());
+  EXPECT_NE(world->EntityID(), clone->EntityID());
+  EXPECT_EQ(world->GetCollisionDetector(), clone->GetCollisionDetector());
+  EXPECT_EQ(5u, clone->GetMaxContacts());
+
+  EXPECT_EQ(world->EntityID(), clone->GetCloneSourceID(clone->EntityID()));
+  EXPECT_EQ(physics::INVALID_ENTITY_ID,
+            world->GetCloneSourceID(world->EntityID()));
+
+  // Every entity of the clone maps back to the entity with the same name
+  ASSERT_EQ(world->GetModelCount(), clone->GetModelCount());
+  for (std::size_t i = 0; i < world->GetModelCount(); ++i)
+  {
+    const auto model = world->GetModel(i);
+    const auto clonedModel = clone->GetModel(i);
+    EXPECT_EQ(model->GetName(), clonedModel->GetName());
+    EXPECT_NE(model->EntityID(), clonedModel->EntityID());
+    EXPECT_EQ(model->EntityID(),
+              clone->GetCloneSourceID(clonedModel->EntityID()));
+
+    ASSERT_EQ(model->GetLinkCount(), clonedModel->GetLinkCount());
+    for (std::size_t j = 0; j < model->GetLinkCount(); ++j)
+    {
+      const auto link = model->GetLink(j);
+      const auto clonedLink = clonedModel->GetLink(j);
+      EXPECT_EQ(link->GetName(), clonedLink->GetName());
+      EXPECT_EQ(link->EntityID(),
+                clone->GetCloneSourceID(clonedLink->EntityID()));
+
+      ASSERT_EQ(link->GetShapeCount(), clonedLink->GetShapeCount());
+      for (std::size_t k = 0; k < link->GetShapeCount(); ++k)
+      {
+        EXPECT_EQ(link->GetShape(k)->GetName(),
+                  clonedLink->GetShape(k)->GetName());
+        EXPECT_EQ(link->GetShape(k)->EntityID(),
+                  clone->GetCloneSourceID(clonedLink->GetShape(k)->EntityID()));
+      }
+    }
+  }
+
+  auto sphere = world->GetModel("sphere")->GetLink(0);
+  auto clonedSphere = clone->GetModel("sphere")->GetLink(0);
+  const auto pose = sphere->FrameDataRelativeToWorld().pose;
+  EXPECT_TRUE(pose.isApprox(clonedSphere->FrameDataRelativeToWorld().pose));
+  EXPECT_TRUE(sphere->FrameDataRelativeToWorld().linearVelocity.isApprox(
+      clonedSphere->FrameDataRelativeToWorld().linearVelocity));
+
+  // Stepping the clone does not move the sphere of the source world, and
+  // the clone lands on its own copy of the ground.
+  for (std::size_t i = 0; i < 1000; ++i)
+    clone->Step(output, state, input);
+
+  EXPECT_TRUE(pose.isApprox(sphere->FrameDataRelativeToWorld().pose));
+  EXPECT_NEAR(1.0,
+      clonedSphere->FrameDataRelativeToWorld().pose.translation().z(), 5e-2);
+
+  // A clone can be cloned again, and maps back to the world it was cloned
+  // from
+  auto secondClone = clone->Clone("second_clone");
+  ASSERT_NE(nullptr, secondClone);
+  EXPECT_EQ(clonedSphere->EntityID(), secondClone->GetCloneSourceID(
+      secondClone->GetModel("sphere")->GetLink(0)->EntityID()));
+
+  EXPECT_EQ(nullptr, world->Clone("clone"));
+}
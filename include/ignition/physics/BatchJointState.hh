@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_BATCHJOINTSTATE_HH_
+#define IGNITION_PHYSICS_BATCHJOINTSTATE_HH_
+
+#include <vector>
+
+#include <ignition/physics/FeatureList.hh>
+
+namespace ignition
+{
+  namespace physics
+  {
+    /////////////////////////////////////////////////
+    /// \brief GetBatchJointState reads the generalized state of every joint
+    /// in a Model (or in every Model of a World) with a single call, filling
+    /// contiguous structure-of-arrays buffers that are owned by the caller.
+    ///
+    /// The generalized coordinates of a Model are laid out in the order given
+    /// by Joint::GetDofIndexInModel(). The coordinates of a World are the
+    /// concatenation of the coordinates of each of its Models, in the order of
+    /// the Model indices within the World.
+    ///
+    /// The output vectors are resized to the number of degrees of freedom, so
+    /// reusing the same vectors across calls avoids any heap allocation once
+    /// they have reached their final size.
+    class IGNITION_PHYSICS_VISIBLE GetBatchJointState : public virtual Feature
+    {
+      /// \brief The Model API for getting the state of all its joints
+      public: template <typename PolicyT, typename FeaturesT>
+      class Model : public virtual Feature::Model<PolicyT, FeaturesT>
+      {
+        public: using Scalar = typename PolicyT::Scalar;
+
+        /// \brief Get the total number of generalized coordinates of all the
+        /// joints in this model.
+        /// \return Number of degrees of freedom of this model
+        public: std::size_t GetDegreesOfFreedom() const;
+
+        /// \brief Get the generalized state of all the joints in this model.
+        /// Pass in a nullptr for any quantity that is not needed.
+        /// \param[out] _positions
+        ///   Filled with the generalized positions
+        /// \param[out] _velocities
+        ///   Filled with the generalized velocities
+        /// \param[out] _accelerations
+        ///   Filled with the generalized accelerations
+        /// \param[out] _forces
+        ///   Filled with the generalized forces
+        public: void GetJointState(
+            std::vector<Scalar> *_positions,
+            std::vector<Scalar> *_velocities = nullptr,
+            std::vector<Scalar> *_accelerations = nullptr,
+            std::vector<Scalar> *_forces = nullptr) const;
+      };
+
+      /// \brief The World API for getting the state of all its joints
+      public: template <typename PolicyT, typename FeaturesT>
+      class World : public virtual Feature::World<PolicyT, FeaturesT>
+      {
+        public: using Scalar = typename PolicyT::Scalar;
+
+        /// \brief Get the total number of generalized coordinates of all the
+        /// models in this world.
+        /// \return Number of degrees of freedom of this world
+        public: std::size_t GetDegreesOfFreedom() const;
+
+        /// \brief Get the generalized state of all the joints of all the
+        /// models in this world. Pass in a nullptr for any quantity that is not
+        /// needed.
+        /// \param[out] _positions
+        ///   Filled with the generalized positions
+        /// \param[out] _velocities
+        ///   Filled with the generalized velocities
+        /// \param[out] _accelerations
+        ///   Filled with the generalized accelerations
+        /// \param[out] _forces
+        ///   Filled with the generalized forces
+        public: void GetJointState(
+            std::vector<Scalar> *_positions,
+            std::vector<Scalar> *_velocities = nullptr,
+            std::vector<Scalar> *_accelerations = nullptr,
+            std::vector<Scalar> *_forces = nullptr) const;
+      };
+
+      /// \brief The Joint API for locating a joint within the batch arrays
+      public: template <typename PolicyT, typename FeaturesT>
+      class Joint : public virtual Feature::Joint<PolicyT, FeaturesT>
+      {
+        /// \brief Get the index of one of the generalized coordinates of this
+        /// joint within the batch arrays of its Model.
+        /// \param[in] _dof
+        ///   The desired generalized coordinate within this joint. Values start
+        ///   from 0 and stop before Joint::GetDegreesOfFreedom().
+        /// \return The index of _dof within Model::GetJointState() arrays
+        public: std::size_t GetDofIndexInModel(const std::size_t _dof) const;
+      };
+
+      /// \private The implementation API for getting batch joint state
+      public: template <typename PolicyT>
+      class Implementation : public virtual Feature::Implementation<PolicyT>
+      {
+        public: using Scalar = typename PolicyT::Scalar;
+
+        // see Model::GetDegreesOfFreedom above
+        public: virtual std::size_t GetModelDegreesOfFreedom(
+            const Identity &_modelID) const = 0;
+
+        // see Model::GetJointState above
+        public: virtual void GetModelJointState(
+            const Identity &_modelID,
+            std::vector<Scalar> *_positions,
+            std::vector<Scalar> *_velocities,
+            std::vector<Scalar> *_accelerations,
+            std::vector<Scalar> *_forces) const = 0;
+
+        // see World::GetDegreesOfFreedom above
+        public: virtual std::size_t GetWorldDegreesOfFreedom(
+            const Identity &_worldID) const = 0;
+
+        // see World::GetJointState above
+        public: virtual void GetWorldJointState(
+            const Identity &_worldID,
+            std::vector<Scalar> *_positions,
+            std::vector<Scalar> *_velocities,
+            std::vector<Scalar> *_accelerations,
+            std::vector<Scalar> *_forces) const = 0;
+
+        // see Joint::GetDofIndexInModel above
+        public: virtual std::size_t GetJointDofIndexInModel(
+            const Identity &_jointID, std::size_t _dof) const = 0;
+      };
+    };
+
+    /////////////////////////////////////////////////
+    /// \brief SetBatchJointState writes generalized state or commands for
+    /// many joints of a Model with a single call.
+    ///
+    /// Each call takes a DOF index map, i.e. the indices of the targeted
+    /// generalized coordinates within the Model, as given by
+    /// GetBatchJointState's Joint::GetDofIndexInModel(), along with a
+    /// contiguous buffer of values where _values[i] is applied to the
+    /// coordinate _dofs[i]. The index map is meant to be built once and reused
+    /// every time step; it remains valid as long as the joints of the Model are
+    /// not changed. A call whose _dofs and _values differ in size, or whose
+    /// _dofs contain an index outside of the Model, is rejected without
+    /// writing any of its values.
+    class IGNITION_PHYSICS_VISIBLE SetBatchJointState
+        : public virtual FeatureWithRequirements<GetBatchJointState>
+    {
+      /// \brief The Model API for setting the state of many joints
+      public: template <typename PolicyT, typename FeaturesT>
+      class Model : public virtual Feature::Model<PolicyT, FeaturesT>
+      {
+        public: using Scalar = typename PolicyT::Scalar;
+
+        /// \brief Set the generalized positions of the coordinates in _dofs.
+        /// \param[in] _dofs
+        ///   Indices of the generalized coordinates within this model.
+        /// \param[in] _values
+        ///   The desired generalized positions. Must have the same size as
+        ///   _dofs.
+        public: void SetJointPositions(
+            const std::vector<std::size_t> &_dofs,
+            const std::vector<Scalar> &_values);
+
+        /// \brief Set the generalized velocities of the coordinates in _dofs.
+        /// \param[in] _dofs
+        ///   Indices of the generalized coordinates within this model.
+        /// \param[in] _values
+        ///   The desired generalized velocities. Must have the same size as
+        ///   _dofs.
+        public: void SetJointVelocities(
+            const std::vector<std::size_t> &_dofs,
+            const std::vector<Scalar> &_values);
+
+        /// \brief Set the generalized forces of the coordinates in _dofs.
+        /// \param[in] _dofs
+        ///   Indices of the generalized coordinates within this model.
+        /// \param[in] _values
+        ///   The desired generalized forces. Must have the same size as _dofs.
+        public: void SetJointForces(
+            const std::vector<std::size_t> &_dofs,
+            const std::vector<Scalar> &_values);
+
+        /// \brief Set the commanded generalized velocities of the coordinates
+        /// in _dofs. This has the same semantics as
+        /// SetJointVelocityCommandFeature's Joint::SetVelocityCommand().
+        /// \param[in] _dofs
+        ///   Indices of the generalized coordinates within this model.
+        /// \param[in] _values
+        ///   The commanded generalized velocities. Must have the same size as
+        ///   _dofs.
+        public: void SetJointVelocityCommands(
+            const std::vector<std::size_t> &_dofs,
+            const std::vector<Scalar> &_values);
+      };
+
+      /// \private The implementation API for setting batch joint state
+      public: template <typename PolicyT>
+      class Implementation : public virtual Feature::Implementation<PolicyT>
+      {
+        public: using Scalar = typename PolicyT::Scalar;
+
+        // see Model::SetJointPositions above
+        public: virtual void SetModelJointPositions(
+            const Identity &_modelID,
+            const std::vector<std::size_t> &_dofs,
+            const std::vector<Scalar> &_values) = 0;
+
+        // see Model::SetJointVelocities above
+        public: virtual void SetModelJointVelocities(
+            const Identity &_modelID,
+            const std::vector<std::size_t> &_dofs,
+            const std::vector<Scalar> &_values) = 0;
+
+        // see Model::SetJointForces above
+        public: virtual void SetModelJointForces(
+            const Identity &_modelID,
+            const std::vector<std::size_t> &_dofs,
+            const std::vector<Scalar> &_values) = 0;
+
+        // see Model::SetJointVelocityCommands above
+        public: virtual void SetModelJointVelocityCommands(
+            const Identity &_modelID,
+            const std::vector<std::size_t> &_dofs,
+            const std::vector<Scalar> &_values) = 0;
+      };
+    };
+  }
+}
+
+#include <ignition/physics/detail/BatchJointState.hh>
+
+#endif
@@ -18,9 +18,11 @@
 #ifndef IGNITION_PHYSICS_COMPOSITEDATA_HH_
 #define IGNITION_PHYSICS_COMPOSITEDATA_HH_
 
+#include <cstddef>
+#include <deque>
 #include <string>
-#include <map>
 #include <set>
+#include <vector>
 
 #include <ignition/utilities/SuppressWarning.hh>
 
@@ -276,7 +278,8 @@ namespace ignition
       /// \param[in] _args
       ///   The arguments to use for construction or assignment. These will get
       ///   wrapped in a Data(...) constructor. If _args is left blank, the
-      ///   default constructor will be used.
+      ///   default constructor will be used. The new value is constructed
+      ///   before an existing entry is replaced, so _args may refer to it.
       ///
       /// \return an InsertResult<Data> which contains a reference to the
       /// Data-type entry of this CompositeData. InsertResult<Data>::inserted
@@ -296,6 +299,10 @@ namespace ignition
       /// this returns true. If the data was marked as required and therefore
       /// not removed, this returns false.
       ///
+      /// The memory which held the object is kept by this CompositeData, so
+      /// that inserting a Data-type object again later does not need to
+      /// allocate. It is released when the CompositeData is destructed.
+      ///
       /// \warning Calling this function will permanently invalidate all
       /// existing references to the Data-type entry of this CompositeData, i.e.
       /// the references that get returned by Get<Data>(), Insert<Data>(~),
@@ -352,6 +359,20 @@ namespace ignition
       public: template <typename Data>
       bool Remove();
 
+      /// \brief Remove every data object of this CompositeData which is not
+      /// required, as if Remove() were called for each of their types. Data
+      /// that is required stays untouched.
+      ///
+      /// Like Remove(), this keeps the memory of the objects that it removes.
+      /// Clearing a CompositeData and refilling it with the same data types,
+      /// e.g. once per simulation step, therefore does not allocate any memory
+      /// after the first time, besides whatever the data types allocate
+      /// themselves.
+      ///
+      /// \warning Calling this function will permanently invalidate all
+      /// existing references to the data which is not required.
+      public: void Clear();
+
       /// \brief Use these flags in Query(), Has(), and StatusOf() to change
       /// their effects on the meta info of the data being queried.
       ///
@@ -954,16 +975,175 @@ namespace ignition
       /// \brief Move operator. Same as Copy(_other).
       public: CompositeData &operator=(CompositeData &&_other);
 
+      /// \brief Identifies a data type within a CompositeData. Each data type
+      /// computes its key only once; see detail::DataTypeKey().
+      /// \private
+      public: struct TypeKey
+      {
+        /// \brief The label of the data type, i.e. typeid(Data).name().
+        /// Labels are compared by value, so that the same type is recognized
+        /// across shared library boundaries.
+        const char *label;
+
+        /// \brief Hash of the label, compared before the label itself
+        std::size_t hash;
+      };
+
+      /// \brief Functions which manage the memory of one data type. Each data
+      /// type creates this only once; see detail::DataTypeOps().
+      /// \private
+      public: struct DataOps
+      {
+        /// \brief Allocate memory for an instance on the heap
+        void *(*allocate)();
+
+        /// \brief Release memory that was given by allocate()
+        void (*deallocate)(void *);
+
+        /// \brief Copy-construct an instance into the given memory
+        Cloneable *(*copyConstruct)(void *, const Cloneable &);
+
+        /// \brief Whether instances are stored inline instead of on the heap
+        bool storesInline;
+      };
+
       /// \brief Struct which contains information about a data type within the
-      /// CompositeData. See ignition/physics/detail/CompositeData.hh for the
-      /// definition. This class is public so that helper functions can use it
+      /// CompositeData. The data instance is stored inline if its type is small
+      /// and trivially copyable, otherwise it is allocated on the heap. Heap
+      /// memory is kept after the instance gets deleted, so that the next
+      /// instance of the entry can reuse it. See
+      /// ignition/physics/detail/CompositeData.hh for the definitions of its
+      /// templates. This class is public so that helper functions can use it
       /// without being friends of the class.
       /// \private
-      public: struct DataEntry;
+      public: struct IGNITION_PHYSICS_VISIBLE DataEntry
+      {
+        /// \brief Size of the buffer which holds inline data instances
+        public: static constexpr std::size_t kInlineSize = 48;
+
+        /// \brief Whether instances of Data get stored inline
+        public: template <typename Data>
+        static constexpr bool StoresInline();
+
+        /// \brief Constructor for an entry that does not have any data yet
+        public: explicit DataEntry(const TypeKey &_key);
+
+        /// \brief Entries never move, so that iterators and references to
+        /// their data stay valid while more entries get added.
+        public: DataEntry(const DataEntry &) = delete;
+
+        /// \brief Entries never move
+        public: DataEntry &operator=(const DataEntry &) = delete;
+
+        /// \brief Destructor. Deletes the data instance and releases the
+        /// memory of the entry.
+        public: ~DataEntry();
+
+        /// \brief Create the data instance of this entry, which must not have
+        /// one yet.
+        /// \return A reference to the new data instance
+        public: template <typename Data, typename... Args>
+        MakeCloneable<Data> &Emplace(Args &&..._args);
+
+        /// \brief Delete the data instance of this entry, if it has one. Its
+        /// memory is kept for the next instance.
+        public: void Reset();
+
+        /// \brief Create a copy of the data instance of _other, which must
+        /// exist, in this entry, which must not have a data instance yet.
+        public: void CloneFrom(const DataEntry &_other);
+
+        /// \brief Take over the data instance of _other, which must exist,
+        /// replacing the instance of this entry if it has one. _other is left
+        /// without a data instance.
+        public: void MoveFrom(DataEntry &_other);
+
+        /// \brief The data type of this entry
+        public: const TypeKey key;
+
+        /// \brief Data that is being held at this entry. nullptr means the
+        /// CompositeData does not have data for this entry
+        public: Cloneable *data;
+
+        /// \brief Flag for whether the type of data at this entry is
+        /// considered to be required. This can be made true during the
+        /// lifetime of the CompositeData, but it must never be changed from
+        /// true to false.
+        public: bool required;
+
+        /// \brief Flag for whether this data entry has been queried since
+        /// either (1) it was created using Copy(~), =, or the CompositeData
+        /// constructor, or (2) the last time ResetQueries() was called,
+        /// whichever was more recent. Functions that can mark an entry as
+        /// queried include Get(), InsertOrAssign(), Insert(), Query(), and
+        /// Has().
+        public: mutable bool queried;
+
+        /// \brief Get the memory for a new data instance, allocating it if
+        /// this entry does not have any yet.
+        private: void *Storage();
+
+        /// \brief Functions which manage the memory of the data type. This is
+        /// a nullptr until the entry has had a data instance.
+        private: const DataOps *ops;
+
+        /// \brief Heap memory for the data instance. It is kept while the
+        /// entry does not have data, and released by the destructor.
+        private: void *heap;
+
+        /// \brief Storage for the inline data instance
+        private: alignas(std::max_align_t) unsigned char buffer[kInlineSize];
+      };
+
+      /// \brief The entries of a CompositeData. The entries themselves are
+      /// never removed or moved, so pointers to them act as iterators which
+      /// stay valid for the lifetime of the CompositeData. Lookups use a flat
+      /// vector of the entries that is sorted by their TypeKey.
+      /// \private
+      public: class IGNITION_PHYSICS_VISIBLE MapOfData
+      {
+        public: using iterator = DataEntry*;
+        public: using const_iterator = const DataEntry*;
+
+        /// \brief Default constructor
+        public: MapOfData() = default;
+
+        /// \brief The entries belong to their CompositeData, so they cannot
+        /// be copied.
+        public: MapOfData(const MapOfData &) = delete;
+
+        /// \brief The entries belong to their CompositeData, so they cannot
+        /// be copied.
+        public: MapOfData &operator=(const MapOfData &) = delete;
+
+        /// \brief Find the entry of a data type
+        /// \return The entry, or a nullptr if there is no entry for _key
+        public: iterator Find(const TypeKey &_key);
 
-      // We make this typedef public so that helper functions can use it without
-      // being friends of the class.
-      public: using MapOfData = std::map<std::string, DataEntry>;
+        /// \brief Find the entry of a data type
+        /// \return The entry, or a nullptr if there is no entry for _key
+        public: const_iterator Find(const TypeKey &_key) const;
+
+        /// \brief Find the entry of a data type, or create an empty entry if
+        /// there is none yet.
+        public: DataEntry &FindOrInsert(const TypeKey &_key);
+
+        /// \brief Create an entry which must not exist yet
+        /// \param[in] _position
+        ///   Where _key belongs in sortedEntries
+        public: DataEntry &Insert(const TypeKey &_key, std::size_t _position);
+
+        /// \brief Get the position where _key belongs in sortedEntries
+        public: std::size_t LowerBound(const TypeKey &_key) const;
+
+        IGN_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
+        /// \brief Every entry, in the order that they were created
+        public: std::deque<DataEntry> entries;
+
+        /// \brief The entries sorted by their TypeKey
+        public: std::vector<DataEntry*> sortedEntries;
+        IGN_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
+      };
 
       IGN_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
       /// \brief Map from the label of a data object type to its entry
@@ -106,6 +106,20 @@ namespace ignition
       /// \return True if this is pointing to a valid Entity, otherwise false.
       public: operator bool() const;
 
+      /// \brief Create a non-owning copy of this EntityPtr. The copy refers to
+      /// the same Entity, but neither it nor any copy made from it shares
+      /// ownership of the physics engine or of the object inside of the
+      /// engine, so copying it never updates an atomic reference count. This
+      /// is meant for read-only hot paths, e.g. handing the same entities to
+      /// several threads on every simulation step.
+      ///
+      /// The borrowed copy must not outlive this EntityPtr (or any other
+      /// owning reference to the same engine), and it must not be used after
+      /// the Entity has been removed from the engine.
+      /// \return A borrowed EntityPtr, or an invalid EntityPtr if this is not
+      /// pointing at a valid Entity.
+      public: EntityPtr Borrow() const;
+
       /// \brief Produces a hash for the Entity that this EntityPtr is referring
       /// to. This function allows EntityPtr instances to be used as values in a
       /// std::unordered_set or keys in a std::unordered_map. Using this
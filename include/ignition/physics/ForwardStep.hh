@@ -86,6 +86,33 @@ namespace ignition
       double dt;
     };
 
+    /// \brief Request that one call to Step takes several internal steps,
+    /// each of which advances the world by its time step. This lets stiff
+    /// models use a small time step while the caller steps at a lower rate.
+    struct SubSteps
+    {
+      /// \brief Number of internal steps per call to Step. A count of 0 is
+      /// rejected with an error, and a single step is taken instead.
+      std::size_t count;
+    };
+
+    /// \brief Request that one call to Step takes as many internal steps as
+    /// fit into the time that has accumulated so far. The time which is left
+    /// over is kept in the State and carried into the next call. When this is
+    /// given, SubSteps is ignored.
+    struct StepAccumulator
+    {
+      /// \brief Time in seconds to add to the accumulated time before
+      /// stepping, e.g. the real time which passed since the last call
+      double elapsed;
+
+      /// \brief Upper limit for the number of internal steps of one call, or
+      /// 0 for no limit. Accumulated time that would exceed the limit is
+      /// dropped, so that a simulation which cannot keep up does not fall
+      /// further and further behind.
+      std::size_t maxSteps;
+    };
+
     struct ForceTorque
     {
       std::size_t body;
@@ -146,7 +173,9 @@ namespace ignition
               ApplyExternalForceTorques,
               ApplyGeneralizedForces,
               VelocityControlCommands,
-              ServoControlCommands>;
+              ServoControlCommands,
+              SubSteps,
+              StepAccumulator>;
 
       public: using Output = SpecifyData<
           RequireData<WorldPoses>,
@@ -175,6 +204,94 @@ namespace ignition
       };
     };
 
+    /////////////////////////////////////////////////
+    /// \brief StepWorldsFeature allows an engine to take one step forward in
+    /// time for several of its worlds at once, stepping the worlds
+    /// concurrently on a pool of worker threads.
+    ///
+    /// Thread-safety contract: StepWorlds blocks until every requested world
+    /// has been stepped. While it is running, no other function may be called
+    /// on the engine or on any of its entities, from any thread; the physics
+    /// plugin is therefore free to read its shared entity maps from every
+    /// worker thread without locking, since nothing modifies them. Each world
+    /// may appear at most once per call, and the Output, State and Input that
+    /// correspond to a world are only accessed by the thread stepping that
+    /// world.
+    class IGNITION_PHYSICS_VISIBLE StepWorldsFeature
+        : public virtual FeatureWithRequirements<ForwardStep>
+    {
+      public: template <typename PolicyT, typename FeaturesT>
+      class Engine : public virtual Feature::Engine<PolicyT, FeaturesT>
+      {
+        public: using WorldPtrType = WorldPtr<PolicyT, FeaturesT>;
+
+        /// \brief Step each world of _worlds forward once. This is
+        /// equivalent to calling World::Step(_h[i], _x[i], _u[i]) on each
+        /// _worlds[i], except that the worlds may be stepped concurrently.
+        /// \param[in] _worlds
+        ///   The distinct worlds to step. They must belong to this engine.
+        /// \param[out] _h
+        ///   Output of each world. Must have the same size as _worlds.
+        /// \param[in,out] _x
+        ///   State of each world. Must have the same size as _worlds.
+        /// \param[in] _u
+        ///   Input of each world. Must have the same size as _worlds.
+        /// \throws Any exception that stepping one of the worlds throws. It
+        /// is rethrown on the calling thread once every world is done.
+        public: void StepWorlds(
+            const std::vector<WorldPtrType> &_worlds,
+            std::vector<ForwardStep::Output> &_h,
+            std::vector<ForwardStep::State> &_x,
+            const std::vector<ForwardStep::Input> &_u)
+        {
+          std::vector<Identity> worldIDs;
+          worldIDs.reserve(_worlds.size());
+          for (const auto &world : _worlds)
+            worldIDs.push_back(world->FullIdentity());
+
+          this->template Interface<StepWorldsFeature>()->
+              EngineStepWorlds(this->identity, worldIDs, _h, _x, _u);
+        }
+
+        /// \brief Set the maximum number of worker threads that StepWorlds
+        /// may use, including the calling thread.
+        /// \param[in] _count
+        ///   The number of threads. A value of 0 lets the engine pick a
+        ///   number based on the hardware concurrency.
+        public: void SetStepWorldsThreadCount(const std::size_t _count)
+        {
+          this->template Interface<StepWorldsFeature>()->
+              SetEngineStepWorldsThreadCount(this->identity, _count);
+        }
+
+        /// \brief Get the maximum number of worker threads that StepWorlds
+        /// may use. A value of 0 means the engine picks a number based on
+        /// the hardware concurrency.
+        public: std::size_t GetStepWorldsThreadCount() const
+        {
+          return this->template Interface<StepWorldsFeature>()->
+              GetEngineStepWorldsThreadCount(this->identity);
+        }
+      };
+
+      public: template <typename PolicyT>
+      class Implementation : public virtual Feature::Implementation<PolicyT>
+      {
+        public: virtual void EngineStepWorlds(
+            const Identity &_engineID,
+            const std::vector<Identity> &_worldIDs,
+            std::vector<ForwardStep::Output> &_h,
+            std::vector<ForwardStep::State> &_x,
+            const std::vector<ForwardStep::Input> &_u) = 0;
+
+        public: virtual void SetEngineStepWorldsThreadCount(
+            const Identity &_engineID, std::size_t _count) = 0;
+
+        public: virtual std::size_t GetEngineStepWorldsThreadCount(
+            const Identity &_engineID) const = 0;
+      };
+    };
+
     // ---------------- SetState Interface -----------------
     // class SetState
     // {
@@ -70,6 +70,41 @@ namespace ignition
     };
     IGN_PHYSICS_MAKE_ALL_TYPE_COMBOS(FrameData)
 
+    /// \brief FrameDataMask lists the fields of a FrameData as bit flags, so
+    /// that callers can ask a physics engine for only the fields they need.
+    /// For example, resolving points or poses only needs the pose of a frame,
+    /// and skipping its velocity and acceleration can save a lot of work in
+    /// engines that compute them lazily.
+    struct FrameDataMask
+    {
+      enum Component : unsigned int
+      {
+        /// \brief FrameData::pose
+        POSE = 1u << 0,
+
+        /// \brief FrameData::linearVelocity
+        LINEAR_VELOCITY = 1u << 1,
+
+        /// \brief FrameData::angularVelocity
+        ANGULAR_VELOCITY = 1u << 2,
+
+        /// \brief FrameData::linearAcceleration
+        LINEAR_ACCELERATION = 1u << 3,
+
+        /// \brief FrameData::angularAcceleration
+        ANGULAR_ACCELERATION = 1u << 4,
+
+        /// \brief Both velocities
+        VELOCITY = LINEAR_VELOCITY | ANGULAR_VELOCITY,
+
+        /// \brief Both accelerations
+        ACCELERATION = LINEAR_ACCELERATION | ANGULAR_ACCELERATION,
+
+        /// \brief Every field
+        ALL = POSE | VELOCITY | ACCELERATION
+      };
+    };
+
     template <typename Scalar, std::size_t Dim>
     std::ostream& operator <<(std::ostream& stream,
                               const FrameData<Scalar, Dim> &_frame)
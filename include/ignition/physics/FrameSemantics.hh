@@ -19,8 +19,10 @@
 #define IGNITION_PHYSICS_FRAMESEMANTICS_HH_
 
 #include <memory>
+#include <vector>
 
 #include <ignition/physics/Feature.hh>
+#include <ignition/physics/FeatureList.hh>
 #include <ignition/physics/Entity.hh>
 #include <ignition/physics/FrameID.hh>
 #include <ignition/physics/FrameData.hh>
@@ -91,6 +93,51 @@ namespace ignition
         RQ Reframe(const RQ &_quantity,
                    const FrameID &_withRespectTo = FrameID::World()) const;
 
+        /// \brief Resolve a batch of RelativeQuantities of the same type.
+        /// This gives the same results as calling Resolve on each quantity,
+        /// but the data of each frame involved is only fetched from the
+        /// physics engine once, which makes a big difference when resolving
+        /// large numbers of quantities, such as point clouds.
+        /// \param[in] _quantities
+        ///   The quantities to resolve. They may have different parent frames,
+        ///   but quantities that share a parent frame should preferably be
+        ///   next to each other.
+        /// \param[out] _results
+        ///   The resolved value of each quantity. This will be resized to
+        ///   match _quantities.
+        /// \param[in] _relativeTo
+        ///   The frame that every quantity should be compared against.
+        /// \param[in] _inCoordinatesOf
+        ///   The frame whose coordinates every result is expressed in.
+        public: template <typename RQ>
+        void Resolve(
+          const std::vector<RQ> &_quantities,
+          std::vector<typename RQ::Quantity> &_results,
+          const FrameID &_relativeTo,
+          const FrameID &_inCoordinatesOf) const;
+
+        /// \brief Resolve a batch of RelativeQuantities relative to, and in
+        /// the coordinates of, _relativeTo.
+        public: template <typename RQ>
+        void Resolve(
+          const std::vector<RQ> &_quantities,
+          std::vector<typename RQ::Quantity> &_results,
+          const FrameID &_relativeTo = FrameID::World()) const;
+
+        /// \brief Reframe a batch of RelativeQuantities of the same type. The
+        /// data of each frame involved is only fetched once.
+        /// \param[in] _quantities
+        ///   The quantities to reframe.
+        /// \param[out] _results
+        ///   The reframed quantities. This will be resized to match
+        ///   _quantities.
+        /// \param[in] _withRespectTo
+        ///   The new parent frame of every quantity.
+        public: template <typename RQ>
+        void Reframe(const std::vector<RQ> &_quantities,
+                     std::vector<RQ> &_results,
+                     const FrameID &_withRespectTo = FrameID::World()) const;
+
         template <typename, typename> friend class FrameSemantics::Frame;
       };
 
@@ -144,6 +191,21 @@ namespace ignition
         public: virtual FrameData FrameDataRelativeToWorld(
           const FrameID &_id) const = 0;
 
+        /// \brief Get only some of the fields of the FrameData of the
+        /// specified frame with respect to the WorldFrame. Resolve uses this
+        /// to skip the fields that a quantity does not depend on.
+        ///
+        /// Engine developers may override this when computing some of the
+        /// fields is expensive. The default implementation returns the whole
+        /// FrameData from FrameDataRelativeToWorld.
+        /// \param[in] _id
+        ///   The frame whose data is requested.
+        /// \param[in] _mask
+        ///   Bitwise combination of FrameDataMask::Component values. The
+        ///   fields that are not requested may be left at their default value.
+        public: virtual FrameData PartialFrameDataRelativeToWorld(
+          const FrameID &_id, unsigned int _mask) const;
+
         /// \brief Physics engines can use this function to generate a FrameID
         /// using an existing Identity.
         ///
@@ -206,6 +268,55 @@ namespace ignition
       public: template <typename Policy, typename Features>
       using Engine = FrameSemantics::Engine<Policy, Features>;
     };
+
+    /////////////////////////////////////////////////
+    /// \brief FrameDataCache lets the physics engine remember the FrameData
+    /// of each frame that it computes until the state of the simulation
+    /// changes, for example when a world is stepped or when a joint position
+    /// is set. When many quantities are resolved between two steps, such as
+    /// in sensor pipelines, the FrameData of each frame is then only computed
+    /// once per step. The cache is disabled by default.
+    ///
+    /// The engine invalidates the cache whenever it is asked to change the
+    /// state of the simulation. If the state is changed behind its back, e.g.
+    /// through a handle to the native physics engine, the cache must be
+    /// invalidated with InvalidateFrameDataCache().
+    class IGNITION_PHYSICS_VISIBLE FrameDataCache
+        : public virtual FeatureWithRequirements<FrameSemantics>
+    {
+      public: template <typename PolicyT, typename FeaturesT>
+      class Engine : public virtual Feature::Engine<PolicyT, FeaturesT>
+      {
+        /// \brief Enable or disable the FrameData cache.
+        /// \param[in] _enabled
+        ///   True to enable the cache, false to disable it and release the
+        ///   cached data.
+        public: void SetFrameDataCacheEnabled(bool _enabled);
+
+        /// \brief Check whether the FrameData cache is enabled.
+        public: bool GetFrameDataCacheEnabled() const;
+
+        /// \brief Discard every cached FrameData, so that it gets computed
+        /// again the next time it is needed.
+        public: void InvalidateFrameDataCache();
+      };
+
+      public: template <typename PolicyT>
+      class Implementation : public virtual Feature::Implementation<PolicyT>
+      {
+        // see Engine::SetFrameDataCacheEnabled above
+        public: virtual void SetEngineFrameDataCacheEnabled(
+            const Identity &_engineID, bool _enabled) = 0;
+
+        // see Engine::GetFrameDataCacheEnabled above
+        public: virtual bool GetEngineFrameDataCacheEnabled(
+            const Identity &_engineID) const = 0;
+
+        // see Engine::InvalidateFrameDataCache above
+        public: virtual void InvalidateEngineFrameDataCache(
+            const Identity &_engineID) = 0;
+      };
+    };
   }
 }
 
@@ -33,12 +33,33 @@ namespace physics
 class IGNITION_PHYSICS_VISIBLE GetContactsFromLastStepFeature
     : public virtual FeatureWithRequirements<ForwardStep>
 {
+  /// \brief Properties of a contact which a physics engine may provide in
+  /// addition to its point
+  public: template <typename PolicyT>
+  struct ExtraContactDataT
+  {
+    using Scalar = typename PolicyT::Scalar;
+    using VectorType = typename FromPolicy<PolicyT>::template Use<Vector>;
+
+    /// \brief The contact force acting on the first body, expressed in the
+    /// world frame
+    VectorType force;
+
+    /// \brief The contact normal, pointing from the second body towards the
+    /// first one, expressed in the world frame
+    VectorType normal;
+
+    /// \brief The penetration depth of the two bodies
+    Scalar depth;
+  };
+
   public: template <typename PolicyT, typename FeaturesT>
   class World : public virtual Feature::World<PolicyT, FeaturesT>
   {
     public: using ShapePtrType = ShapePtr<PolicyT, FeaturesT>;
     public: using VectorType =
         typename FromPolicy<PolicyT>::template Use<Vector>;
+    public: using ExtraContactData = ExtraContactDataT<PolicyT>;
 
     public: struct ContactPoint
     {
@@ -50,7 +71,11 @@ class IGNITION_PHYSICS_VISIBLE GetContactsFromLastStepFeature
       VectorType point;
     };
 
-    public: using Contact = RequireData<ContactPoint>;
+    /// \brief A contact always has a ContactPoint, and it also has an
+    /// ExtraContactData if the physics engine provides one.
+    public: using Contact = SpecifyData<
+        RequireData<ContactPoint>,
+        ExpectData<ExtraContactData>>;
 
     /// \brief Get contacts generated in the previous simulation step
     public: std::vector<Contact> GetContactsFromLastStep() const;
@@ -61,6 +86,7 @@ class IGNITION_PHYSICS_VISIBLE GetContactsFromLastStepFeature
   {
     public: using VectorType =
         typename FromPolicy<PolicyT>::template Use<Vector>;
+    public: using ExtraContactData = ExtraContactDataT<PolicyT>;
 
     public: struct ContactInternal
     {
@@ -70,7 +96,7 @@ class IGNITION_PHYSICS_VISIBLE GetContactsFromLastStepFeature
       Identity collision2;
       /// \brief The point of contact expressed in the world frame
       VectorType point;
-      /// \brief Extra data related to contact.
+      /// \brief Extra data related to contact, such as an ExtraContactData.
       CompositeData extraData;
     };
 
@@ -78,6 +104,71 @@ class IGNITION_PHYSICS_VISIBLE GetContactsFromLastStepFeature
         const Identity &_worldID) const = 0;
   };
 };
+
+/// \brief GetContactRecordsFromLastStepFeature retrieves the contacts
+/// generated in the previous simulation step as plain records which are
+/// written into a buffer owned by the caller.
+///
+/// Unlike GetContactsFromLastStepFeature, no entity handles or CompositeData
+/// are created for the contacts, so reusing the same buffer every step avoids
+/// any heap allocation once the buffer has grown to the largest number of
+/// contacts seen so far.
+class IGNITION_PHYSICS_VISIBLE GetContactRecordsFromLastStepFeature
+    : public virtual FeatureWithRequirements<ForwardStep>
+{
+  /// \brief A single contact
+  public: template <typename PolicyT>
+  struct ContactRecordT
+  {
+    using Scalar = typename PolicyT::Scalar;
+    using VectorType = typename FromPolicy<PolicyT>::template Use<Vector>;
+
+    /// \brief Entity ID of the first collision shape, as given by
+    /// Shape::EntityID()
+    std::size_t collision1;
+
+    /// \brief Entity ID of the second collision shape, as given by
+    /// Shape::EntityID()
+    std::size_t collision2;
+
+    /// \brief The point of contact expressed in the world frame
+    VectorType point;
+
+    /// \brief The contact normal, pointing from the second shape towards the
+    /// first one, expressed in the world frame
+    VectorType normal;
+
+    /// \brief The contact force acting on the first shape, expressed in the
+    /// world frame
+    VectorType force;
+
+    /// \brief The penetration depth of the two shapes
+    Scalar depth;
+  };
+
+  public: template <typename PolicyT, typename FeaturesT>
+  class World : public virtual Feature::World<PolicyT, FeaturesT>
+  {
+    public: using ContactRecord = ContactRecordT<PolicyT>;
+
+    /// \brief Get the contacts generated in the previous simulation step.
+    /// \param[out] _contacts
+    ///   Overwritten with the contacts. Its capacity is kept, so passing the
+    ///   same vector every step does not allocate memory.
+    public: void GetContactRecordsFromLastStep(
+        std::vector<ContactRecord> &_contacts) const;
+  };
+
+  public: template <typename PolicyT>
+  class Implementation : public virtual Feature::Implementation<PolicyT>
+  {
+    public: using ContactRecord = ContactRecordT<PolicyT>;
+
+    public: virtual void GetContactRecordsFromLastStep(
+        const Identity &_worldID,
+        std::vector<ContactRecord> &_contacts) const = 0;
+  };
+};
 }
 }
 
@@ -19,6 +19,7 @@
 #define IGNITION_PHYSICS_REMOVEENTITIES_HH_
 
 #include <string>
+#include <vector>
 
 #include <ignition/physics/FeatureList.hh>
 
@@ -73,8 +74,40 @@ namespace ignition
       };
     };
 
+    /// \brief Remove many Models of a World with a single call. The cost of
+    /// each removal does not depend on the number of Models that are left in
+    /// the World, so this is suited to despawning large batches of Models.
+    class IGNITION_PHYSICS_VISIBLE RemoveModelsFromWorld
+        : public virtual Feature
+    {
+      public: template <typename PolicyT, typename FeaturesT>
+      class World : public virtual Feature::World<PolicyT, FeaturesT>
+      {
+        public: using ModelPtrType = ModelPtr<PolicyT, FeaturesT>;
+
+        /// \brief Remove a set of Models that exist within this World.
+        /// Models which do not belong to this World or which have already
+        /// been removed are skipped.
+        /// \param[in] _models
+        ///   The models to remove.
+        /// \return The number of models that were found and removed.
+        public: std::size_t RemoveModels(
+            const std::vector<ModelPtrType> &_models);
+      };
+
+      public: template <typename PolicyT>
+      class Implementation : public virtual Feature::Implementation<PolicyT>
+      {
+        // World functions
+        public: virtual std::size_t RemoveModels(
+            const Identity &_worldID,
+            const std::vector<Identity> &_modelIDs) = 0;
+      };
+    };
+
     using RemoveEntities = FeatureList<
-      RemoveModelFromWorld
+      RemoveModelFromWorld,
+      RemoveModelsFromWorld
     >;
   }
 }
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_WORLD_HH_
+#define IGNITION_PHYSICS_WORLD_HH_
+
+#include <string>
+
+#include <ignition/physics/FeatureList.hh>
+
+namespace ignition
+{
+  namespace physics
+  {
+    /////////////////////////////////////////////////
+    /// \brief CollisionDetector selects the collision detection backend that
+    /// a World uses, which lets users trade accuracy for speed. It can be
+    /// changed at any time, including right after the World is constructed;
+    /// the new backend takes effect on the next step.
+    class IGNITION_PHYSICS_VISIBLE CollisionDetector : public virtual Feature
+    {
+      /// \brief The World API for setting the collision detector
+      public: template <typename PolicyT, typename FeaturesT>
+      class World : public virtual Feature::World<PolicyT, FeaturesT>
+      {
+        /// \brief Set the collision detector of this world.
+        /// \param[in] _collisionDetector
+        ///   Name of the collision detector. The names that are supported
+        ///   depend on the physics engine, e.g. "ode", "fcl", "bullet" or
+        ///   "dart" for dartsim.
+        /// \return True if the collision detector was found and is now used
+        /// by this world. Otherwise the world keeps its current detector.
+        public: bool SetCollisionDetector(
+            const std::string &_collisionDetector);
+
+        /// \brief Get the name of the collision detector of this world.
+        public: const std::string &GetCollisionDetector() const;
+      };
+
+      /// \private The implementation API for the collision detector
+      public: template <typename PolicyT>
+      class Implementation : public virtual Feature::Implementation<PolicyT>
+      {
+        // see World::SetCollisionDetector above
+        public: virtual bool SetWorldCollisionDetector(
+            const Identity &_worldID,
+            const std::string &_collisionDetector) = 0;
+
+        // see World::GetCollisionDetector above
+        public: virtual const std::string &GetWorldCollisionDetector(
+            const Identity &_worldID) const = 0;
+      };
+    };
+
+    /////////////////////////////////////////////////
+    /// \brief WorldMaxContacts limits the total number of contacts that a
+    /// World generates in each step.
+    class IGNITION_PHYSICS_VISIBLE WorldMaxContacts : public virtual Feature
+    {
+      /// \brief The World API for setting the maximum number of contacts
+      public: template <typename PolicyT, typename FeaturesT>
+      class World : public virtual Feature::World<PolicyT, FeaturesT>
+      {
+        /// \brief Set the maximum number of contacts that this world will
+        /// generate in a single step.
+        /// \param[in] _maxContacts
+        ///   Maximum number of contacts.
+        public: void SetMaxContacts(std::size_t _maxContacts);
+
+        /// \brief Get the maximum number of contacts that this world will
+        /// generate in a single step.
+        public: std::size_t GetMaxContacts() const;
+      };
+
+      /// \private The implementation API for the maximum number of contacts
+      public: template <typename PolicyT>
+      class Implementation : public virtual Feature::Implementation<PolicyT>
+      {
+        // see World::SetMaxContacts above
+        public: virtual void SetWorldMaxContacts(
+            const Identity &_worldID, std::size_t _maxContacts) = 0;
+
+        // see World::GetMaxContacts above
+        public: virtual std::size_t GetWorldMaxContacts(
+            const Identity &_worldID) const = 0;
+      };
+    };
+
+    /////////////////////////////////////////////////
+    /// \brief CloneWorld creates independent copies of a World, e.g. to step
+    /// several rollouts from the same state, without constructing the copies
+    /// from their descriptions again.
+    class IGNITION_PHYSICS_VISIBLE CloneWorld : public virtual Feature
+    {
+      /// \brief The World API for cloning worlds
+      public: template <typename PolicyT, typename FeaturesT>
+      class World : public virtual Feature::World<PolicyT, FeaturesT>
+      {
+        public: using WorldPtrType = WorldPtr<PolicyT, FeaturesT>;
+
+        /// \brief Create a copy of this world, including its models, their
+        /// state and the settings of the world. The models, links, joints
+        /// and shapes of the copy have the same names and indices as the
+        /// ones of this world, but they are new entities, so the copy can be
+        /// stepped and modified without affecting this world.
+        /// \param[in] _name
+        ///   Name of the new world. It must not be the name of another world
+        ///   of the engine.
+        /// \return The new world, or a null world if it could not be created.
+        public: WorldPtrType Clone(const std::string &_name);
+
+        /// \brief Get the entity of the world that this world was cloned
+        /// from which an entity of this world was copied from.
+        /// \param[in] _entityID
+        ///   ID of this world or of one of its models, links, joints or
+        ///   shapes, as given by EntityID().
+        /// \return The ID of the source entity, or INVALID_ENTITY_ID if this
+        /// world is not a clone or if the entity was created after the
+        /// world was cloned.
+        public: std::size_t GetCloneSourceID(std::size_t _entityID) const;
+      };
+
+      /// \private The implementation API for cloning worlds
+      public: template <typename PolicyT>
+      class Implementation : public virtual Feature::Implementation<PolicyT>
+      {
+        // see World::Clone above
+        public: virtual Identity CloneWorld(
+            const Identity &_worldID, const std::string &_name) = 0;
+
+        // see World::GetCloneSourceID above
+        public: virtual std::size_t GetWorldCloneSourceID(
+            const Identity &_worldID, std::size_t _entityID) const = 0;
+      };
+    };
+  }
+}
+
+#include <ignition/physics/detail/World.hh>
+
+#endif
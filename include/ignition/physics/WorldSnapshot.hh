@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef IGNITION_PHYSICS_WORLDSNAPSHOT_HH_
+#define IGNITION_PHYSICS_WORLDSNAPSHOT_HH_
+
+#include <vector>
+#include <ignition/physics/FeatureList.hh>
+#include <ignition/physics/ForwardStep.hh>
+#include <ignition/physics/Geometry.hh>
+
+namespace ignition
+{
+namespace physics
+{
+/// \brief WorldSnapshotFeature lets other threads read the state of a world
+/// while it keeps stepping.
+///
+/// Once snapshots are enabled for a world, the physics engine copies the
+/// state of the world into a snapshot at the end of each step and publishes
+/// it. ReadLatestSnapshot() copies the most recently published snapshot
+/// without ever waiting for a step to finish, and a step never waits for the
+/// readers either, so slow consumers such as rendering or logging threads do
+/// not hold back the simulation.
+///
+/// Thread-safety contract: ReadLatestSnapshot may be called from any number
+/// of threads at any time, including while the world is being stepped. Every
+/// other function of this feature must not be called concurrently with a
+/// step or with ReadLatestSnapshot.
+class IGNITION_PHYSICS_VISIBLE WorldSnapshotFeature
+    : public virtual FeatureWithRequirements<ForwardStep>
+{
+  /// \brief The state of a world at the end of one of its steps
+  public: template <typename PolicyT>
+  struct WorldSnapshotT
+  {
+    using Scalar = typename PolicyT::Scalar;
+    using PoseType = typename FromPolicy<PolicyT>::template Use<Pose>;
+    using LinearVectorType =
+        typename FromPolicy<PolicyT>::template Use<LinearVector>;
+    using AngularVectorType =
+        typename FromPolicy<PolicyT>::template Use<AngularVector>;
+
+    /// \brief The state of a single link
+    struct LinkState
+    {
+      /// \brief Entity ID of the link, as given by Link::EntityID()
+      std::size_t link;
+
+      /// \brief Pose of the link in the world frame
+      PoseType pose;
+
+      /// \brief Linear velocity of the link in the world frame
+      LinearVectorType linearVelocity;
+
+      /// \brief Angular velocity of the link in the world frame
+      AngularVectorType angularVelocity;
+    };
+
+    /// \brief Number of steps that the world had taken
+    std::size_t step;
+
+    /// \brief Simulation time of the world
+    Scalar time;
+
+    /// \brief State of each link of the world
+    std::vector<LinkState> links;
+
+    /// \brief Entity ID of the joint of each degree of freedom. A joint with
+    /// several degrees of freedom has consecutive entries, in order.
+    std::vector<std::size_t> jointDofs;
+
+    /// \brief Position of each degree of freedom of jointDofs
+    std::vector<Scalar> jointPositions;
+
+    /// \brief Velocity of each degree of freedom of jointDofs
+    std::vector<Scalar> jointVelocities;
+  };
+
+  public: template <typename PolicyT, typename FeaturesT>
+  class World : public virtual Feature::World<PolicyT, FeaturesT>
+  {
+    public: using WorldSnapshot = WorldSnapshotT<PolicyT>;
+
+    /// \brief Enable or disable publishing a snapshot after each step of
+    /// this world. Snapshots are disabled by default.
+    /// \param[in] _enabled
+    ///   True to publish snapshots, false to stop publishing them and release
+    ///   the published ones.
+    public: void SetSnapshotsEnabled(bool _enabled);
+
+    /// \brief Check whether this world publishes snapshots
+    public: bool GetSnapshotsEnabled() const;
+
+    /// \brief Copy the snapshot that was published most recently. This may
+    /// be called from any thread, even while the world is being stepped.
+    /// \param[out] _snapshot
+    ///   Overwritten with the snapshot. Its capacity is kept, so passing the
+    ///   same snapshot every time does not allocate memory.
+    /// \return True if a snapshot was copied, false if none has been
+    /// published yet.
+    public: bool ReadLatestSnapshot(WorldSnapshot &_snapshot) const;
+  };
+
+  public: template <typename PolicyT>
+  class Implementation : public virtual Feature::Implementation<PolicyT>
+  {
+    public: using WorldSnapshot = WorldSnapshotT<PolicyT>;
+
+    // see World::SetSnapshotsEnabled above
+    public: virtual void SetWorldSnapshotsEnabled(
+        const Identity &_worldID, bool _enabled) = 0;
+
+    // see World::GetSnapshotsEnabled above
+    public: virtual bool GetWorldSnapshotsEnabled(
+        const Identity &_worldID) const = 0;
+
+    // see World::ReadLatestSnapshot above
+    public: virtual bool ReadWorldLatestSnapshot(
+        const Identity &_worldID, WorldSnapshot &_snapshot) const = 0;
+  };
+};
+}
+}
+
+#include "ignition/physics/detail/WorldSnapshot.hh"
+
+#endif
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_DETAIL_BATCHJOINTSTATE_HH_
+#define IGNITION_PHYSICS_DETAIL_BATCHJOINTSTATE_HH_
+
+#include <vector>
+
+#include <ignition/physics/BatchJointState.hh>
+
+namespace ignition
+{
+  namespace physics
+  {
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    std::size_t GetBatchJointState::Model<PolicyT, FeaturesT>::
+    GetDegreesOfFreedom() const
+    {
+      return this->template Interface<GetBatchJointState>()
+          ->GetModelDegreesOfFreedom(this->identity);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    void GetBatchJointState::Model<PolicyT, FeaturesT>::GetJointState(
+        std::vector<Scalar> *_positions,
+        std::vector<Scalar> *_velocities,
+        std::vector<Scalar> *_accelerations,
+        std::vector<Scalar> *_forces) const
+    {
+      this->template Interface<GetBatchJointState>()
+          ->GetModelJointState(this->identity,
+                               _positions, _velocities, _accelerations, _forces);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    std::size_t GetBatchJointState::World<PolicyT, FeaturesT>::
+    GetDegreesOfFreedom() const
+    {
+      return this->template Interface<GetBatchJointState>()
+          ->GetWorldDegreesOfFreedom(this->identity);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    void GetBatchJointState::World<PolicyT, FeaturesT>::GetJointState(
+        std::vector<Scalar> *_positions,
+        std::vector<Scalar> *_velocities,
+        std::vector<Scalar> *_accelerations,
+        std::vector<Scalar> *_forces) const
+    {
+      this->template Interface<GetBatchJointState>()
+          ->GetWorldJointState(this->identity,
+                               _positions, _velocities, _accelerations, _forces);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    std::size_t GetBatchJointState::Joint<PolicyT, FeaturesT>::
+    GetDofIndexInModel(const std::size_t _dof) const
+    {
+      return this->template Interface<GetBatchJointState>()
+          ->GetJointDofIndexInModel(this->identity, _dof);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    void SetBatchJointState::Model<PolicyT, FeaturesT>::SetJointPositions(
+        const std::vector<std::size_t> &_dofs,
+        const std::vector<Scalar> &_values)
+    {
+      this->template Interface<SetBatchJointState>()
+          ->SetModelJointPositions(this->identity, _dofs, _values);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    void SetBatchJointState::Model<PolicyT, FeaturesT>::SetJointVelocities(
+        const std::vector<std::size_t> &_dofs,
+        const std::vector<Scalar> &_values)
+    {
+      this->template Interface<SetBatchJointState>()
+          ->SetModelJointVelocities(this->identity, _dofs, _values);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    void SetBatchJointState::Model<PolicyT, FeaturesT>::SetJointForces(
+        const std::vector<std::size_t> &_dofs,
+        const std::vector<Scalar> &_values)
+    {
+      this->template Interface<SetBatchJointState>()
+          ->SetModelJointForces(this->identity, _dofs, _values);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    void SetBatchJointState::Model<PolicyT, FeaturesT>::
+    SetJointVelocityCommands(
+        const std::vector<std::size_t> &_dofs,
+        const std::vector<Scalar> &_values)
+    {
+      this->template Interface<SetBatchJointState>()
+          ->SetModelJointVelocityCommands(this->identity, _dofs, _values);
+    }
+  }
+}
+
+#endif
@@ -18,52 +18,117 @@
 #ifndef IGNITION_PHYSICS_DETAIL_COMPOSITEDATA_HH_
 #define IGNITION_PHYSICS_DETAIL_COMPOSITEDATA_HH_
 
+#include <cassert>
+#include <cstring>
 #include <memory>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
 #include <utility>
 
-#include <ignition/utilities/SuppressWarning.hh>
-
 #include "ignition/physics/CompositeData.hh"
 
 namespace ignition
 {
   namespace physics
   {
-    /// \brief Struct which contains information about a data type within the
-    /// CompositeData.
-    /// \private
-    struct IGNITION_PHYSICS_VISIBLE CompositeData::DataEntry
-    {
-      /// \brief Default constructor
-      public: DataEntry();
-
-      /// \brief Constructor that accepts an rvalue reference and a
-      /// requirement setting
-      public: DataEntry(
-        std::unique_ptr<Cloneable> &&_data,
-        bool _required);
-
-      IGN_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
-      /// \brief Data that is being held at this entry. nullptr means the
-      /// CompositeData does not have data for this entry
-      public: std::unique_ptr<Cloneable> data;
-      IGN_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
-
-      /// \brief Flag for whether the type of data at this entry is considered
-      /// to be required. This can be made true during the lifetime of the
-      /// CompositeData, but it must never be changed from true to false.
-      public: bool required;
-
-      /// \brief Flag for whether this data entry has been queried since
-      /// either (1) it was created using Copy(~), =, or the CompositeData
-      /// constructor, or (2) the last time ResetQueries() was called,
-      /// whichever was more recent. Functions that can mark an entry as
-      /// queried include Get(), InsertOrAssign(), Insert(), Query(), and Has().
-      public: mutable bool queried;
-    };
-
     namespace detail
     {
+      /////////////////////////////////////////////////
+      /// \brief Compute the key of a data type label
+      /// \private
+      inline CompositeData::TypeKey MakeTypeKey(const char *_label)
+      {
+        // 64-bit FNV-1a
+        std::size_t hash = static_cast<std::size_t>(14695981039346656037ull);
+        for (const char *c = _label; *c != '\0'; ++c)
+        {
+          hash ^= static_cast<unsigned char>(*c);
+          hash *= static_cast<std::size_t>(1099511628211ull);
+        }
+
+        return CompositeData::TypeKey{_label, hash};
+      }
+
+      /////////////////////////////////////////////////
+      /// \brief Get the key of a data type. It is only computed the first
+      /// time that each data type is used.
+      /// \private
+      template <typename Data>
+      const CompositeData::TypeKey &DataTypeKey()
+      {
+        static const CompositeData::TypeKey key =
+            MakeTypeKey(typeid(Data).name());
+        return key;
+      }
+
+      /////////////////////////////////////////////////
+      /// \brief Get the functions which manage the memory of a data type
+      /// \private
+      template <typename Data>
+      const CompositeData::DataOps &DataTypeOps()
+      {
+        using Instance = MakeCloneable<Data>;
+        static constexpr bool overAligned =
+            alignof(Instance) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+        static const CompositeData::DataOps ops{
+          []() -> void*
+          {
+            if constexpr (overAligned)
+            {
+              return ::operator new(
+                    sizeof(Instance), std::align_val_t(alignof(Instance)));
+            }
+            else
+            {
+              return ::operator new(sizeof(Instance));
+            }
+          },
+          [](void *_memory)
+          {
+            if constexpr (overAligned)
+              ::operator delete(_memory, std::align_val_t(alignof(Instance)));
+            else
+              ::operator delete(_memory);
+          },
+          [](void *_memory, const Cloneable &_other) -> Cloneable*
+          {
+            return new (_memory) Instance(
+                  static_cast<const Instance&>(_other));
+          },
+          CompositeData::DataEntry::StoresInline<Data>()
+        };
+
+        return ops;
+      }
+
+      /////////////////////////////////////////////////
+      /// \brief Strict weak ordering for TypeKeys
+      /// \private
+      inline bool TypeKeyLess(
+          const CompositeData::TypeKey &_lhs,
+          const CompositeData::TypeKey &_rhs)
+      {
+        if (_lhs.hash != _rhs.hash)
+          return _lhs.hash < _rhs.hash;
+
+        return _lhs.label != _rhs.label
+            && std::strcmp(_lhs.label, _rhs.label) < 0;
+      }
+
+      /////////////////////////////////////////////////
+      /// \brief Check whether two TypeKeys refer to the same data type
+      /// \private
+      inline bool TypeKeyEqual(
+          const CompositeData::TypeKey &_lhs,
+          const CompositeData::TypeKey &_rhs)
+      {
+        return _lhs.hash == _rhs.hash
+            && (_lhs.label == _rhs.label
+                || std::strcmp(_lhs.label, _rhs.label) == 0);
+      }
+
       /////////////////////////////////////////////////
       /// \brief Helper function to set the query flag of previously unqueried
       /// data entries. The template argument is to support both iterator&
@@ -72,10 +137,10 @@ namespace ignition
       template <typename IteratorType>
       void SetToQueried(const IteratorType &_it, std::size_t &_numQueries)
       {
-        if (!_it->second.queried)
+        if (!_it->queried)
         {
           ++_numQueries;
-          _it->second.queried = true;
+          _it->queried = true;
         }
       }
 
@@ -90,48 +155,138 @@ namespace ignition
           CompositeData::MapOfData &_dataMap,
           Args &&..._args)
       {
-        bool inserted = false;
-        const CompositeData::MapOfData::iterator it = _dataMap.insert(
-              std::make_pair(typeid(Data).name(),
-                             CompositeData::DataEntry())).first;
+        CompositeData::DataEntry &entry =
+            _dataMap.FindOrInsert(DataTypeKey<Data>());
+        const bool inserted = !entry.data;
 
-        if (!it->second.data)
+        if (inserted)
         {
+          entry.Emplace<Data>(std::forward<Args>(_args)...);
           ++_numEntries;
-          it->second.data = std::unique_ptr<Cloneable>(
-                new MakeCloneable<Data>(std::forward<Args>(_args)...));
-          inserted = true;
         }
         else if (_assign)
         {
-          static_cast<MakeCloneable<Data>&>(*it->second.data) =
-              MakeCloneable<Data>(std::forward<Args>(_args)...);
+          // Construct the new value before the old one is destroyed, so that
+          // the old value survives if construction throws and _args may
+          // refer to it. The new value is then moved into the memory of the
+          // old one.
+          MakeCloneable<Data> value(std::forward<Args>(_args)...);
+          entry.Reset();
+          --_numEntries;
+          entry.Emplace<Data>(std::move(value));
+          ++_numEntries;
         }
 
-        detail::SetToQueried(it, _numQueries);
+        detail::SetToQueried(&entry, _numQueries);
 
         return CompositeData::InsertResult<Data>{
-          static_cast<MakeCloneable<Data>&>(*it->second.data),
+          static_cast<MakeCloneable<Data>&>(*entry.data),
           inserted};
       }
     }
 
+    /////////////////////////////////////////////////
+    template <typename Data>
+    constexpr bool CompositeData::DataEntry::StoresInline()
+    {
+      return std::is_trivially_copyable<Data>::value
+          && sizeof(MakeCloneable<Data>) <= kInlineSize
+          && alignof(MakeCloneable<Data>) <= alignof(std::max_align_t);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename Data, typename... Args>
+    MakeCloneable<Data> &CompositeData::DataEntry::Emplace(Args &&..._args)
+    {
+      assert(!this->data &&
+             "Creating the data of an entry which already has data. This "
+             "should not be possible! Please report this bug!");
+
+      if (!this->ops)
+        this->ops = &detail::DataTypeOps<Data>();
+
+      MakeCloneable<Data> *instance = new (this->Storage()) MakeCloneable<Data>(
+            std::forward<Args>(_args)...);
+
+      this->data = instance;
+      return *instance;
+    }
+
+    /////////////////////////////////////////////////
+    inline std::size_t CompositeData::MapOfData::LowerBound(
+        const TypeKey &_key) const
+    {
+      std::size_t first = 0;
+      std::size_t count = this->sortedEntries.size();
+      while (count > 0)
+      {
+        const std::size_t step = count / 2;
+        const std::size_t middle = first + step;
+        if (detail::TypeKeyLess(this->sortedEntries[middle]->key, _key))
+        {
+          first = middle + 1;
+          count -= step + 1;
+        }
+        else
+        {
+          count = step;
+        }
+      }
+
+      return first;
+    }
+
+    /////////////////////////////////////////////////
+    inline auto CompositeData::MapOfData::Find(const TypeKey &_key)
+        -> iterator
+    {
+      const std::size_t position = this->LowerBound(_key);
+      if (position < this->sortedEntries.size()
+          && detail::TypeKeyEqual(this->sortedEntries[position]->key, _key))
+      {
+        return this->sortedEntries[position];
+      }
+
+      return nullptr;
+    }
+
+    /////////////////////////////////////////////////
+    inline auto CompositeData::MapOfData::Find(const TypeKey &_key) const
+        -> const_iterator
+    {
+      return const_cast<MapOfData*>(this)->Find(_key);
+    }
+
+    /////////////////////////////////////////////////
+    inline CompositeData::DataEntry &CompositeData::MapOfData::FindOrInsert(
+        const TypeKey &_key)
+    {
+      const std::size_t position = this->LowerBound(_key);
+      if (position < this->sortedEntries.size()
+          && detail::TypeKeyEqual(this->sortedEntries[position]->key, _key))
+      {
+        return *this->sortedEntries[position];
+      }
+
+      return this->Insert(_key, position);
+    }
+
     /////////////////////////////////////////////////
     template <typename Data>
     Data &CompositeData::Get()
     {
-      const MapOfData::iterator it = this->dataMap.insert(
-            std::make_pair(typeid(Data).name(), DataEntry())).first;
+      DataEntry &entry =
+          this->dataMap.FindOrInsert(detail::DataTypeKey<Data>());
 
-      if (!it->second.data)
+      if (!entry.data)
       {
         ++this->numEntries;
-        it->second.data = std::unique_ptr<Cloneable>(new MakeCloneable<Data>());
+        entry.Emplace<Data>();
       }
 
-      detail::SetToQueried(it, this->numQueries);
+      detail::SetToQueried(&entry, this->numQueries);
 
-      return static_cast<MakeCloneable<Data>&>(*it->second.data);
+      return static_cast<MakeCloneable<Data>&>(*entry.data);
     }
 
     /////////////////////////////////////////////////
@@ -157,24 +312,24 @@ namespace ignition
     bool CompositeData::Remove()
     {
       const MapOfData::iterator it =
-          this->dataMap.find(typeid(Data).name());
+          this->dataMap.Find(detail::DataTypeKey<Data>());
 
-      if (this->dataMap.end() == it || !it->second.data)
+      if (!it || !it->data)
         return true;
 
       // Do not remove it if it's required
-      if (it->second.required)
+      if (it->required)
         return false;
 
       // Decrement the query count if it had been queried
-      if (it->second.queried)
+      if (it->queried)
       {
         --this->numQueries;
-        it->second.queried = false;
+        it->queried = false;
       }
 
       --this->numEntries;
-      it->second.data.reset();
+      it->Reset();
       return true;
     }
 
@@ -183,18 +338,18 @@ namespace ignition
     Data *CompositeData::Query(const QueryMode _mode)
     {
       const MapOfData::const_iterator it =
-          this->dataMap.find(typeid(Data).name());
+          this->dataMap.Find(detail::DataTypeKey<Data>());
 
-      if (this->dataMap.end() == it)
+      if (!it)
         return nullptr;
 
-      if (!it->second.data)
+      if (!it->data)
         return nullptr;
 
       if (QueryMode::NORMAL == _mode)
         detail::SetToQueried(it, this->numQueries);
 
-      return static_cast<MakeCloneable<Data>*>(it->second.data.get());
+      return static_cast<MakeCloneable<Data>*>(it->data);
     }
 
     /////////////////////////////////////////////////
@@ -202,18 +357,18 @@ namespace ignition
     const Data *CompositeData::Query(const QueryMode _mode) const
     {
       const MapOfData::const_iterator it =
-          this->dataMap.find(typeid(Data).name());
+          this->dataMap.Find(detail::DataTypeKey<Data>());
 
-      if (this->dataMap.end() == it)
+      if (!it)
         return nullptr;
 
-      if (!it->second.data)
+      if (!it->data)
         return nullptr;
 
       if (QueryMode::NORMAL == _mode)
         detail::SetToQueried(it, this->numQueries);
 
-      return static_cast<const MakeCloneable<Data>*>(it->second.data.get());
+      return static_cast<const MakeCloneable<Data>*>(it->data);
     }
 
     /////////////////////////////////////////////////
@@ -231,17 +386,17 @@ namespace ignition
       DataStatus status;
 
       const MapOfData::const_iterator it =
-          this->dataMap.find(typeid(Data).name());
+          this->dataMap.Find(detail::DataTypeKey<Data>());
 
-      if (this->dataMap.end() == it)
+      if (!it)
         return status;
 
-      if (!it->second.data)
+      if (!it->data)
         return status;
 
       status.exists = true;
-      status.required = it->second.required;
-      status.queried = it->second.queried;
+      status.required = it->required;
+      status.queried = it->queried;
 
       return status;
     }
@@ -251,19 +406,19 @@ namespace ignition
     bool CompositeData::Unquery() const
     {
       const MapOfData::const_iterator it =
-          this->dataMap.find(typeid(Data).name());
+          this->dataMap.Find(detail::DataTypeKey<Data>());
 
-      if (this->dataMap.end() == it)
+      if (!it)
         return false;
 
-      if (!it->second.data)
+      if (!it->data)
         return false;
 
-      if (!it->second.queried)
+      if (!it->queried)
         return false;
 
       --this->numQueries;
-      it->second.queried = false;
+      it->queried = false;
 
       return true;
     }
@@ -272,20 +427,19 @@ namespace ignition
     template <typename Data, typename... Args>
     Data &CompositeData::MakeRequired(Args &&..._args)
     {
-      const MapOfData::iterator it = this->dataMap.insert(
-            std::make_pair(typeid(Data).name(), DataEntry())).first;
+      DataEntry &entry =
+          this->dataMap.FindOrInsert(detail::DataTypeKey<Data>());
 
-      it->second.required = true;
-      if (!it->second.data)
+      entry.required = true;
+      if (!entry.data)
       {
         ++this->numEntries;
-        it->second.data = std::unique_ptr<Cloneable>(
-              new MakeCloneable<Data>(std::forward<Args>(_args)...));
+        entry.Emplace<Data>(std::forward<Args>(_args)...);
       }
 
-      detail::SetToQueried(it, this->numQueries);
+      detail::SetToQueried(&entry, this->numQueries);
 
-      return static_cast<MakeCloneable<Data>&>(*it->second.data);
+      return static_cast<MakeCloneable<Data>&>(*entry.data);
     }
 
     /////////////////////////////////////////////////
@@ -293,12 +447,12 @@ namespace ignition
     bool CompositeData::Requires() const
     {
       const MapOfData::const_iterator it =
-          this->dataMap.find(typeid(Data).name());
+          this->dataMap.Find(detail::DataTypeKey<Data>());
 
-      if (this->dataMap.end() == it)
+      if (!it)
         return false;
 
-      return it->second.required;
+      return it->required;
     }
 
     /////////////////////////////////////////////////
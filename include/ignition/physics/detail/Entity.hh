@@ -253,7 +253,9 @@ namespace ignition
         return *this;
       }
 
-      if (this->entity)
+      // A borrowed pimpl belongs to another EntityPtr, so we must not write
+      // into it.
+      if (this->entity && this->entity->pimpl.use_count() > 0)
       {
         // Emplace to set the identity because assigment is not possible. Use
         // the entity's own pimpl temporarily for the construction and copy
@@ -302,6 +304,26 @@ namespace ignition
       return this->entity.has_value();
     }
 
+    /////////////////////////////////////////////////
+    template <typename EntityT>
+    EntityPtr<EntityT> EntityPtr<EntityT>::Borrow() const
+    {
+      EntityPtr borrowed;
+      if (!this->entity)
+        return borrowed;
+
+      using Pimpl = typename EntityT::Pimpl;
+      const std::shared_ptr<Pimpl> &pimpl = this->entity->pimpl;
+
+      // Alias the pimpl without a control block, the same way that
+      // Identity::Borrow() aliases the reference of the entity.
+      borrowed.entity.emplace(
+            std::shared_ptr<Pimpl>(std::shared_ptr<Pimpl>(), pimpl.get()),
+            this->entity->identity.Borrow());
+
+      return borrowed;
+    }
+
     /////////////////////////////////////////////////
     template <typename EntityT>
     std::size_t EntityPtr<EntityT>::Hash() const
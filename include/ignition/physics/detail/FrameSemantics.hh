@@ -18,7 +18,13 @@
 #ifndef IGNITION_PHYSICS_DETAIL_FRAMESEMANTICS_HH_
 #define IGNITION_PHYSICS_DETAIL_FRAMESEMANTICS_HH_
 
+#include <map>
 #include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
 
 #include <ignition/physics/FrameSemantics.hh>
 
@@ -28,6 +34,21 @@ namespace ignition
   {
     namespace detail
     {
+      /// \brief The FrameData fields that a coordinate space needs in order to
+      /// resolve its quantities. Only the pose is needed, except for
+      /// FrameData itself.
+      template <typename Space>
+      struct RequiredFrameData
+      {
+        static constexpr unsigned int value = FrameDataMask::POSE;
+      };
+
+      template <typename Scalar, std::size_t Dim>
+      struct RequiredFrameData<FrameSpace<Scalar, Dim>>
+      {
+        static constexpr unsigned int value = FrameDataMask::ALL;
+      };
+
       template <typename PolicyT, typename RQ>
       static typename RQ::Quantity Resolve(
           const FrameSemantics::Implementation<PolicyT> &_impl,
@@ -39,6 +60,7 @@ namespace ignition
         using Space = typename RQ::Space;
         using FrameDataType = typename Space::FrameDataType;
         using RotationType = typename Space::RotationType;
+        constexpr unsigned int mask = RequiredFrameData<Space>::value;
 
         const FrameID &parentFrameID = _quantity.ParentFrame();
 
@@ -57,15 +79,16 @@ namespace ignition
           }
 
           q = _quantity.RelativeToParent();
-          currentCoordinates = _impl.FrameDataRelativeToWorld(
-                _relativeTo).pose.linear();
+          currentCoordinates = _impl.PartialFrameDataRelativeToWorld(
+                _relativeTo, FrameDataMask::POSE).pose.linear();
         }
         else
         {
           // We should only ask for the FrameData if the parent frame is not the
           // world frame.
           const FrameDataType parentFrameData = parentFrameID.IsWorld() ?
-                FrameDataType() : _impl.FrameDataRelativeToWorld(parentFrameID);
+                FrameDataType() :
+                _impl.PartialFrameDataRelativeToWorld(parentFrameID, mask);
 
           if (_relativeTo.IsWorld())
           {
@@ -82,7 +105,7 @@ namespace ignition
           else
           {
             const FrameDataType relativeToData =
-                _impl.FrameDataRelativeToWorld(_relativeTo);
+                _impl.PartialFrameDataRelativeToWorld(_relativeTo, mask);
 
             q = Space::ResolveToTargetFrame(
                   _quantity.RelativeToParent(),
@@ -104,7 +127,8 @@ namespace ignition
           else
           {
             const RotationType inCoordinatesOfRotation =
-                _impl.FrameDataRelativeToWorld(_inCoordinatesOf).pose.linear();
+                _impl.PartialFrameDataRelativeToWorld(
+                  _inCoordinatesOf, FrameDataMask::POSE).pose.linear();
 
             return Space::ResolveToTargetCoordinates(
                   q, currentCoordinates, inCoordinatesOfRotation);
@@ -113,6 +137,221 @@ namespace ignition
 
         return q;
       }
+
+      /// \brief Points and free vectors are resolved by an affine map which
+      /// only depends on their parent frame, so a batch of them can be
+      /// resolved with one matrix product per parent frame.
+      template <typename Space>
+      struct IsAffineSpace : std::false_type { };
+
+      template <typename Scalar, std::size_t Dim>
+      struct IsAffineSpace<EuclideanSpace<Scalar, Dim>> : std::true_type { };
+
+      template <typename Scalar, std::size_t Dim>
+      struct IsAffineSpace<VectorSpace<Scalar, Dim>>
+        : std::integral_constant<bool, (Dim > 1)> { };
+
+      /// \brief Resolves quantities of one Space against the same _relativeTo
+      /// and _inCoordinatesOf frames. The data of those frames is fetched once
+      /// on construction, and the data of each parent frame is fetched the
+      /// first time that frame is seen.
+      template <typename PolicyT, typename Space>
+      class BatchResolver
+      {
+        public: using Quantity = typename Space::Quantity;
+        public: using FrameDataType = typename Space::FrameDataType;
+        public: using RotationType = typename Space::RotationType;
+        public: static constexpr unsigned int mask =
+            RequiredFrameData<Space>::value;
+
+        public: BatchResolver(
+            const FrameSemantics::Implementation<PolicyT> &_impl,
+            const FrameID &_relativeTo,
+            const FrameID &_inCoordinatesOf)
+          : impl(_impl),
+            relativeTo(_relativeTo),
+            inCoordinatesOf(_inCoordinatesOf),
+            // The World Frame has all zero fields
+            relativeToData(_relativeTo.IsWorld() ?
+              FrameDataType() :
+              _impl.PartialFrameDataRelativeToWorld(_relativeTo, mask)),
+            currentCoordinates(relativeToData.pose.linear()),
+            changeCoordinates(_relativeTo != _inCoordinatesOf),
+            inCoordinatesOfRotation(
+              (!changeCoordinates || _inCoordinatesOf.IsWorld()) ?
+                RotationType::Identity() :
+                RotationType(_impl.PartialFrameDataRelativeToWorld(
+                               _inCoordinatesOf, FrameDataMask::POSE)
+                                 .pose.linear()))
+        {
+          // Do nothing
+        }
+
+        /// \brief Get the data of a parent frame. Quantities that share a
+        /// parent frame are usually next to each other, so the map is only
+        /// searched when the parent frame changes.
+        public: const FrameDataType &ParentData(const FrameID &_parentID)
+        {
+          if (!this->lastParentID || _parentID != *this->lastParentID)
+          {
+            auto it = this->parentFrameData.find(_parentID);
+            if (it == this->parentFrameData.end())
+            {
+              it = this->parentFrameData.emplace(
+                    _parentID, _parentID.IsWorld() ?
+                      FrameDataType() :
+                      this->impl.PartialFrameDataRelativeToWorld(
+                        _parentID, mask)).first;
+            }
+
+            this->lastParentID = &it->first;
+            this->lastParentData = &it->second;
+          }
+
+          return *this->lastParentData;
+        }
+
+        /// \brief Resolve a quantity whose parent frame is _parentID. This
+        /// follows the same steps as Resolve.
+        /// \tparam S
+        ///   The Space whose functions are used. Points use VectorSpace to
+        ///   resolve the linear part of their affine map.
+        public: template <typename S = Space>
+        Quantity Resolve(const Quantity &_quantity, const FrameID &_parentID)
+        {
+          Quantity q;
+          if (_parentID == this->relativeTo)
+          {
+            q = _quantity;
+          }
+          else if (this->relativeTo.IsWorld())
+          {
+            q = S::ResolveToWorldFrame(_quantity, this->ParentData(_parentID));
+          }
+          else
+          {
+            q = S::ResolveToTargetFrame(
+                  _quantity, this->ParentData(_parentID),
+                  this->relativeToData);
+          }
+
+          if (!this->changeCoordinates)
+            return q;
+
+          if (this->inCoordinatesOf.IsWorld())
+            return S::ResolveToWorldCoordinates(q, this->currentCoordinates);
+
+          return S::ResolveToTargetCoordinates(
+                q, this->currentCoordinates, this->inCoordinatesOfRotation);
+        }
+
+        private: const FrameSemantics::Implementation<PolicyT> &impl;
+        private: const FrameID &relativeTo;
+        private: const FrameID &inCoordinatesOf;
+        private: const FrameDataType relativeToData;
+        private: const RotationType currentCoordinates;
+        private: const bool changeCoordinates;
+        private: const RotationType inCoordinatesOfRotation;
+
+        private: std::map<FrameID, FrameDataType> parentFrameData;
+        private: const FrameID *lastParentID = nullptr;
+        private: const FrameDataType *lastParentData = nullptr;
+      };
+
+      /// \brief Batch version of Resolve. The data of every frame involved is
+      /// only fetched once for the whole batch.
+      ///
+      /// Points and free vectors are grouped into runs of quantities that
+      /// share a parent frame. The affine map of each parent frame is computed
+      /// once, and it is applied to a whole run with a single matrix product
+      /// on an Eigen::Map of the results. Other quantities are resolved one at
+      /// a time.
+      template <typename PolicyT, typename RQ>
+      static void ResolveBatch(
+          const FrameSemantics::Implementation<PolicyT> &_impl,
+          const std::vector<RQ> &_quantities,
+          std::vector<typename RQ::Quantity> &_results,
+          const FrameID &_relativeTo,
+          const FrameID &_inCoordinatesOf)
+      {
+        using Space = typename RQ::Space;
+        using Quantity = typename RQ::Quantity;
+
+        _results.resize(_quantities.size());
+        if (_quantities.empty())
+          return;
+
+        BatchResolver<PolicyT, Space> resolver(
+              _impl, _relativeTo, _inCoordinatesOf);
+
+        if constexpr (!IsAffineSpace<Space>::value)
+        {
+          for (std::size_t i = 0; i < _quantities.size(); ++i)
+          {
+            _results[i] = resolver.Resolve(
+                  _quantities[i].RelativeToParent(),
+                  _quantities[i].ParentFrame());
+          }
+        }
+        else
+        {
+          using Scalar = typename Space::Scalar;
+          constexpr int Dim = Space::Dimension;
+          using LinearSpace = VectorSpace<Scalar, Dim>;
+          using Matrix = Eigen::Matrix<Scalar, Dim, Eigen::Dynamic>;
+          static_assert(sizeof(Quantity) == Dim * sizeof(Scalar),
+                        "The results must be contiguous coordinates");
+
+          for (std::size_t i = 0; i < _quantities.size(); ++i)
+            _results[i] = _quantities[i].RelativeToParent();
+
+          Eigen::Map<Matrix> coordinates(
+                _results.front().data(), Dim,
+                static_cast<Eigen::Index>(_results.size()));
+
+          // The affine map of each parent frame, as its linear part and its
+          // offset
+          std::map<FrameID, std::pair<
+              typename Space::RotationType, Quantity>> affineMaps;
+
+          std::size_t begin = 0;
+          while (begin < _quantities.size())
+          {
+            const FrameID &parentID = _quantities[begin].ParentFrame();
+            std::size_t end = begin + 1;
+            while (end < _quantities.size()
+                   && _quantities[end].ParentFrame() == parentID)
+            {
+              ++end;
+            }
+
+            auto it = affineMaps.find(parentID);
+            if (it == affineMaps.end())
+            {
+              // The offset is where the origin of the parent frame resolves
+              // to. The linear part is the same for points and free vectors.
+              typename Space::RotationType linear;
+              for (int j = 0; j < Dim; ++j)
+              {
+                linear.col(j) = resolver.template Resolve<LinearSpace>(
+                      Quantity::Unit(j), parentID);
+              }
+
+              it = affineMaps.emplace(parentID, std::make_pair(
+                    linear, resolver.Resolve(Quantity::Zero(), parentID)))
+                  .first;
+            }
+
+            auto block = coordinates.middleCols(
+                  static_cast<Eigen::Index>(begin),
+                  static_cast<Eigen::Index>(end - begin));
+            block = it->second.first * block;
+            block.colwise() += it->second.second;
+
+            begin = end;
+          }
+        }
+      }
     }
 
     /////////////////////////////////////////////////
@@ -147,6 +386,48 @@ namespace ignition
                 this->Resolve(_quantity, _withRespectTo, _withRespectTo));
     }
 
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    template <typename RQ>
+    void FrameSemantics::Engine<PolicyT, FeaturesT>::Resolve(
+        const std::vector<RQ> &_quantities,
+        std::vector<typename RQ::Quantity> &_results,
+        const FrameID &_relativeTo,
+        const FrameID &_inCoordinatesOf) const
+    {
+      detail::ResolveBatch<PolicyT>(
+            *this->template Interface<FrameSemantics>(),
+            _quantities, _results, _relativeTo, _inCoordinatesOf);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    template <typename RQ>
+    void FrameSemantics::Engine<PolicyT, FeaturesT>::Resolve(
+        const std::vector<RQ> &_quantities,
+        std::vector<typename RQ::Quantity> &_results,
+        const FrameID &_relativeTo) const
+    {
+      this->Resolve(_quantities, _results, _relativeTo, _relativeTo);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    template <typename RQ>
+    void FrameSemantics::Engine<PolicyT, FeaturesT>::Reframe(
+        const std::vector<RQ> &_quantities,
+        std::vector<RQ> &_results,
+        const FrameID &_withRespectTo) const
+    {
+      std::vector<typename RQ::Quantity> resolved;
+      this->Resolve(_quantities, resolved, _withRespectTo, _withRespectTo);
+
+      _results.clear();
+      _results.reserve(resolved.size());
+      for (const auto &quantity : resolved)
+        _results.emplace_back(_withRespectTo, quantity);
+    }
+
     /////////////////////////////////////////////////
     template <typename PolicyT, typename FeaturesT>
     FrameID FrameSemantics::Frame<PolicyT, FeaturesT>::GetFrameID() const
@@ -200,6 +481,15 @@ namespace ignition
       return this->GetFrameID();
     }
 
+    /////////////////////////////////////////////////
+    template <typename PolicyT>
+    auto FrameSemantics::Implementation<PolicyT>::
+    PartialFrameDataRelativeToWorld(
+        const FrameID &_id, const unsigned int /*_mask*/) const -> FrameData
+    {
+      return this->FrameDataRelativeToWorld(_id);
+    }
+
     /////////////////////////////////////////////////
     template <typename PolicyT>
     FrameID FrameSemantics::Implementation<PolicyT>::GenerateFrameID(
@@ -207,6 +497,32 @@ namespace ignition
     {
       return FrameID(_identity);
     }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    void FrameDataCache::Engine<PolicyT, FeaturesT>::SetFrameDataCacheEnabled(
+        const bool _enabled)
+    {
+      this->template Interface<FrameDataCache>()
+          ->SetEngineFrameDataCacheEnabled(this->identity, _enabled);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    bool FrameDataCache::Engine<PolicyT, FeaturesT>::
+    GetFrameDataCacheEnabled() const
+    {
+      return this->template Interface<FrameDataCache>()
+          ->GetEngineFrameDataCacheEnabled(this->identity);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    void FrameDataCache::Engine<PolicyT, FeaturesT>::InvalidateFrameDataCache()
+    {
+      this->template Interface<FrameDataCache>()
+          ->InvalidateEngineFrameDataCache(this->identity);
+    }
   }
 }
 
@@ -54,10 +54,27 @@ auto GetContactsFromLastStepFeature::World<
     //
     auto &contactOutput = output.emplace_back();
     contactOutput.template Get<ContactPoint>() = std::move(contactPoint);
+
+    auto *extraContactData =
+        contact.extraData.template Query<ExtraContactData>();
+    if (extraContactData)
+    {
+      contactOutput.template Get<ExtraContactData>() =
+          std::move(*extraContactData);
+    }
   }
   return output;
 }
 
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+void GetContactRecordsFromLastStepFeature::World<PolicyT, FeaturesT>::
+GetContactRecordsFromLastStep(std::vector<ContactRecord> &_contacts) const
+{
+  this->template Interface<GetContactRecordsFromLastStepFeature>()
+      ->GetContactRecordsFromLastStep(this->identity, _contacts);
+}
+
 }  // namespace physics
 }  // namespace ignition
 
@@ -45,10 +45,33 @@ namespace ignition
             std::size_t _id,
             const std::shared_ptr<void> &_ref = nullptr) const;
 
+        /// \brief An implementation class can call this instead of
+        /// GenerateIdentity when it wants to hand out an identity without
+        /// sharing ownership of the object that _ref points to. Copying the
+        /// resulting Identity (and any entity made from it) never touches a
+        /// reference count, which makes it suitable for lookups that happen
+        /// on every simulation step, such as contact lists.
+        ///
+        /// The implementation remains responsible for keeping *_ref alive. If
+        /// _generation is not 0, Reference() will ask IsCurrentGeneration()
+        /// whether the entity is still alive before it hands out *_ref.
+        /// \param[in] _id
+        ///   The ID of the entity
+        /// \param[in] _ref
+        ///   A borrowed pointer to the object inside the implementation
+        /// \param[in] _generation
+        ///   The generation of the entity, or 0 to skip the check
+        protected: Identity GenerateBorrowedIdentity(
+            std::size_t _id,
+            void *_ref,
+            std::size_t _generation = 0) const;
+
         protected: Identity GenerateInvalidId() const;
 
         /// \brief An implementation class can use this function to get the
         /// reference contained in the identity
+        /// \throws std::out_of_range if the identity borrows the reference of
+        /// an entity whose generation is no longer current.
         protected: const std::shared_ptr<void> &Reference(
             const Identity &_identity) const;
 
@@ -62,6 +85,16 @@ namespace ignition
         {
           return static_cast<T *>(this->Reference(_identity).get());
         }
+
+        /// \brief Implementations that hand out borrowed identities with a
+        /// generation should override this to tell whether the entity of
+        /// _identity still has that generation.
+        /// \return True if the reference of _identity can still be used.
+        protected: virtual bool IsCurrentGeneration(
+            const Identity &_identity) const;
+
+        /// \brief Virtual destructor
+        public: virtual ~Implementation() = default;
       };
     }
 
@@ -79,6 +112,18 @@ namespace ignition
       /// \brief Convert to the id value of this Identity.
       public: operator std::size_t() const;
 
+      /// \brief Check whether the reference of this Identity is borrowed,
+      /// i.e. it points to an object without sharing its ownership.
+      /// \return True if ref is not a nullptr and does not own what it points
+      /// to, otherwise false.
+      public: bool Borrowed() const;
+
+      /// \brief Create a copy of this Identity whose reference points to the
+      /// same object without sharing its ownership. The copy must not outlive
+      /// the entity that it refers to.
+      /// \return A borrowed copy of this Identity.
+      public: Identity Borrow() const;
+
       /// \brief This integer ID uniquely identifies the object that this
       /// entity is referring to. No two entities may use the same ID unless
       /// they are referring to the same instance of a physics engine object.
@@ -99,6 +144,11 @@ namespace ignition
       public: const std::shared_ptr<void> ref;
       IGN_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
 
+      /// \brief The generation of the entity that a borrowed reference was
+      /// taken from, or 0 if the reference is not checked. See
+      /// Implementation::GenerateBorrowedIdentity.
+      public: std::size_t generation;
+
       /// \brief This is used by Entity so that it can default-construct. This
       /// should never actually be called.
       private: Identity();
@@ -106,7 +156,8 @@ namespace ignition
       /// \brief This is called by Feature::Implementation
       private: Identity(
           std::size_t _id,
-          const std::shared_ptr<void> &_ref);
+          const std::shared_ptr<void> &_ref,
+          std::size_t _generation = 0);
 
       // These friends are the only classes allowed to create an identity
       template <typename, typename> friend class ::ignition::physics::Entity;
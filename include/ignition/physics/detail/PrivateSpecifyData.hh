@@ -71,18 +71,17 @@ namespace ignition
           usedExpectedDataAccess = true;
           #endif
 
-          if (!this->expectedIterator->second.data)
+          if (!this->expectedIterator->data)
           {
             ++_data->CompositeData::numEntries;
-            this->expectedIterator->second.data =
-                std::unique_ptr<Cloneable>(new MakeCloneable<Expected>());
+            this->expectedIterator->template Emplace<Expected>();
           }
 
           SetToQueried(this->expectedIterator,
                        _data->CompositeData::numQueries);
 
           return static_cast<MakeCloneable<Expected>&>(
-                *this->expectedIterator->second.data);
+                *this->expectedIterator->data);
         }
 
         /// \brief Delegate the function to the standard CompositeData method
@@ -103,21 +102,33 @@ namespace ignition
           usedExpectedDataAccess = true;
           #endif
 
-          if (!this->expectedIterator->second.data)
-            ++_data->CompositeData::numEntries;
-
-          const bool inserted = !this->expectedIterator->second.data;
+          const bool inserted = !this->expectedIterator->data;
 
-          this->expectedIterator->second.data =
-              std::unique_ptr<Cloneable>(new MakeCloneable<Expected>(
-                                           std::forward<Args>(args)...));
+          if (inserted)
+          {
+            this->expectedIterator->template Emplace<Expected>(
+                  std::forward<Args>(args)...);
+            ++_data->CompositeData::numEntries;
+          }
+          else
+          {
+            // Construct the new value first, like
+            // CompositeData::InsertOrAssign, then move it into the memory of
+            // the old one.
+            MakeCloneable<Expected> value(std::forward<Args>(args)...);
+            this->expectedIterator->Reset();
+            --_data->CompositeData::numEntries;
+            this->expectedIterator->template Emplace<Expected>(
+                  std::move(value));
+            ++_data->CompositeData::numEntries;
+          }
 
           SetToQueried(this->expectedIterator,
                        _data->CompositeData::numQueries);
 
           return CompositeData::InsertResult<Expected>{
                 static_cast<MakeCloneable<Expected>&>(
-                  *this->expectedIterator->second.data),
+                  *this->expectedIterator->data),
                 inserted};
         }
 
@@ -141,11 +152,11 @@ namespace ignition
 
           bool inserted = false;
 
-          if (!this->expectedIterator->second.data)
+          if (!this->expectedIterator->data)
           {
             ++_data->CompositeData::numEntries;
-            this->expectedIterator->second.data = std::unique_ptr<Cloneable>(
-                  new MakeCloneable<Expected>(std::forward<Args>(args)...));
+            this->expectedIterator->template Emplace<Expected>(
+                  std::forward<Args>(args)...);
             inserted = true;
           }
 
@@ -154,7 +165,7 @@ namespace ignition
 
           return CompositeData::InsertResult<Expected>{
                 static_cast<MakeCloneable<Expected>&>(
-                  *this->expectedIterator->second.data),
+                  *this->expectedIterator->data),
                 inserted};
         }
 
@@ -172,20 +183,20 @@ namespace ignition
           usedExpectedDataAccess = true;
           #endif
 
-          if (!this->expectedIterator->second.data)
+          if (!this->expectedIterator->data)
             return true;
 
-          if (this->expectedIterator->second.required)
+          if (this->expectedIterator->required)
             return false;
 
-          if (this->expectedIterator->second.queried)
+          if (this->expectedIterator->queried)
           {
             --_data->CompositeData::numQueries;
-            this->expectedIterator->second.queried = false;
+            this->expectedIterator->queried = false;
           }
 
           --_data->CompositeData::numEntries;
-          this->expectedIterator->second.data.reset();
+          this->expectedIterator->Reset();
           return true;
         }
 
@@ -205,7 +216,7 @@ namespace ignition
           usedExpectedDataAccess = true;
           #endif
 
-          if (!this->expectedIterator->second.data)
+          if (!this->expectedIterator->data)
             return nullptr;
 
           if (CompositeData::QueryMode::NORMAL == _mode)
@@ -215,7 +226,7 @@ namespace ignition
           }
 
           return static_cast<MakeCloneable<Expected>*>(
-                this->expectedIterator->second.data.get());
+                this->expectedIterator->data);
         }
 
         /// \brief Delegate the function to the standard CompositeData method
@@ -235,7 +246,7 @@ namespace ignition
           usedExpectedDataAccess = true;
           #endif
 
-          if (!this->expectedIterator->second.data)
+          if (!this->expectedIterator->data)
             return nullptr;
 
           if (CompositeData::QueryMode::NORMAL == _mode)
@@ -245,7 +256,7 @@ namespace ignition
           }
 
           return static_cast<const MakeCloneable<Expected>*>(
-                this->expectedIterator->second.data.get());
+                this->expectedIterator->data);
         }
 
         /// \brief Use this->Query to perform the the Has function
@@ -275,12 +286,12 @@ namespace ignition
           // status is initialized to everything being false
           CompositeData::DataStatus status;
 
-          if (!this->expectedIterator->second.data)
+          if (!this->expectedIterator->data)
             return status;
 
           status.exists = true;
-          status.required = this->expectedIterator->second.required;
-          status.queried = this->expectedIterator->second.queried;
+          status.required = this->expectedIterator->required;
+          status.queried = this->expectedIterator->queried;
 
           return status;
         }
@@ -300,14 +311,14 @@ namespace ignition
           usedExpectedDataAccess = true;
           #endif
 
-          if (!this->expectedIterator->second.data)
+          if (!this->expectedIterator->data)
             return false;
 
-          if (!this->expectedIterator->second.queried)
+          if (!this->expectedIterator->queried)
             return false;
 
           --_data->CompositeData::numQueries;
-          this->expectedIterator->second.queried = false;
+          this->expectedIterator->queried = false;
 
           return true;
         }
@@ -330,20 +341,20 @@ namespace ignition
           usedExpectedDataAccess = true;
           #endif
 
-          this->expectedIterator->second.required = true;
+          this->expectedIterator->required = true;
 
-          if (!this->expectedIterator->second.data)
+          if (!this->expectedIterator->data)
           {
             ++_data->CompositeData::numEntries;
-            this->expectedIterator->second.data = std::unique_ptr<Cloneable>(
-                  new MakeCloneable<Expected>(std::forward<Args>(_args)...));
+            this->expectedIterator->template Emplace<Expected>(
+                  std::forward<Args>(_args)...);
           }
 
           SetToQueried(this->expectedIterator,
               _data->CompositeData::numQueries);
 
           return static_cast<MakeCloneable<Expected>&>(
-                *this->expectedIterator->second.data);
+                *this->expectedIterator->data);
         }
 
         /// \brief Delegate the function to the standard CompositeData method
@@ -360,7 +371,7 @@ namespace ignition
           usedExpectedDataAccess = true;
           #endif
 
-          return this->expectedIterator->second.required;
+          return this->expectedIterator->required;
         }
 
         /// \brief Always returns false
@@ -405,7 +416,7 @@ namespace ignition
 
           SetToQueried(_it, _data->CompositeData::numQueries);
 
-          return static_cast<const MakeCloneable<Required>&>(*_it->second.data);
+          return static_cast<const MakeCloneable<Required>&>(*_it->data);
         }
 
         /// \brief Use a high-speed accessor for this Required data type
@@ -420,7 +431,7 @@ namespace ignition
 
           SetToQueried(_it, _data->CompositeData::numQueries);
 
-          return static_cast<const MakeCloneable<Required>&>(*_it->second.data);
+          return static_cast<const MakeCloneable<Required>&>(*_it->data);
         }
 
         /// \brief Always returns false
@@ -19,6 +19,8 @@
 #define IGNITION_PHYSICS_DETAIL_REMOVEENTITIES_HH_
 
 #include <string>
+#include <vector>
+
 #include <ignition/physics/RemoveEntities.hh>
 
 namespace ignition
@@ -59,6 +61,23 @@ namespace ignition
       return this->template Interface<RemoveModelFromWorld>()
               ->ModelRemoved(this->identity);
     }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    std::size_t RemoveModelsFromWorld::World<PolicyT, FeaturesT>::RemoveModels(
+        const std::vector<ModelPtrType> &_models)
+    {
+      std::vector<Identity> modelIDs;
+      modelIDs.reserve(_models.size());
+      for (const ModelPtrType &model : _models)
+      {
+        if (model)
+          modelIDs.push_back(model->FullIdentity());
+      }
+
+      return this->template Interface<RemoveModelsFromWorld>()
+              ->RemoveModels(this->identity, modelIDs);
+    }
   }
 }
 
@@ -32,9 +32,7 @@ namespace ignition
     ExpectData<Expected>::ExpectData()
       : CompositeData(),
         privateExpectData(
-          this->dataMap.insert(
-            std::make_pair(typeid(Expected).name(),
-                           CompositeData::DataEntry())).first)
+          &this->dataMap.FindOrInsert(detail::DataTypeKey<Expected>()))
     {
       // Do nothing
     }
@@ -156,12 +154,11 @@ namespace ignition
         ExpectData<Required>()
     {
       CompositeData::DataEntry &entry =
-          this->ExpectData<Required>::privateExpectData
-            .expectedIterator->second;
+          *this->ExpectData<Required>::privateExpectData.expectedIterator;
 
       // Create the required data in its designated map entry, and mark it as
       // required for runtime checking.
-      entry.data = std::unique_ptr<Cloneable>(new MakeCloneable<Required>());
+      entry.Emplace<Required>();
       entry.required = true;
       ++CompositeData::numEntries;
     }
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_DETAIL_WORLD_HH_
+#define IGNITION_PHYSICS_DETAIL_WORLD_HH_
+
+#include <string>
+
+#include <ignition/physics/World.hh>
+
+namespace ignition
+{
+  namespace physics
+  {
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    bool CollisionDetector::World<PolicyT, FeaturesT>::SetCollisionDetector(
+        const std::string &_collisionDetector)
+    {
+      return this->template Interface<CollisionDetector>()
+          ->SetWorldCollisionDetector(this->identity, _collisionDetector);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    const std::string &CollisionDetector::World<PolicyT, FeaturesT>::
+    GetCollisionDetector() const
+    {
+      return this->template Interface<CollisionDetector>()
+          ->GetWorldCollisionDetector(this->identity);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    void WorldMaxContacts::World<PolicyT, FeaturesT>::SetMaxContacts(
+        const std::size_t _maxContacts)
+    {
+      this->template Interface<WorldMaxContacts>()
+          ->SetWorldMaxContacts(this->identity, _maxContacts);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    std::size_t WorldMaxContacts::World<PolicyT, FeaturesT>::
+    GetMaxContacts() const
+    {
+      return this->template Interface<WorldMaxContacts>()
+          ->GetWorldMaxContacts(this->identity);
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    auto CloneWorld::World<PolicyT, FeaturesT>::Clone(
+        const std::string &_name) -> WorldPtrType
+    {
+      return WorldPtrType(this->pimpl,
+            this->template Interface<CloneWorld>()
+                ->CloneWorld(this->identity, _name));
+    }
+
+    /////////////////////////////////////////////////
+    template <typename PolicyT, typename FeaturesT>
+    std::size_t CloneWorld::World<PolicyT, FeaturesT>::GetCloneSourceID(
+        const std::size_t _entityID) const
+    {
+      return this->template Interface<CloneWorld>()
+          ->GetWorldCloneSourceID(this->identity, _entityID);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef IGNITION_PHYSICS_DETAIL_WORLDSNAPSHOT_HH_
+#define IGNITION_PHYSICS_DETAIL_WORLDSNAPSHOT_HH_
+
+#include <ignition/physics/WorldSnapshot.hh>
+
+namespace ignition
+{
+namespace physics
+{
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+void WorldSnapshotFeature::World<PolicyT, FeaturesT>::SetSnapshotsEnabled(
+    const bool _enabled)
+{
+  this->template Interface<WorldSnapshotFeature>()
+      ->SetWorldSnapshotsEnabled(this->identity, _enabled);
+}
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+bool WorldSnapshotFeature::World<PolicyT, FeaturesT>::GetSnapshotsEnabled()
+    const
+{
+  return this->template Interface<WorldSnapshotFeature>()
+      ->GetWorldSnapshotsEnabled(this->identity);
+}
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+bool WorldSnapshotFeature::World<PolicyT, FeaturesT>::ReadLatestSnapshot(
+    WorldSnapshot &_snapshot) const
+{
+  return this->template Interface<WorldSnapshotFeature>()
+      ->ReadWorldLatestSnapshot(this->identity, _snapshot);
+}
+
+}  // namespace physics
+}  // namespace ignition
+
+#endif
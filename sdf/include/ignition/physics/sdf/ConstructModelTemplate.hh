@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_SDF_CONSTRUCTMODELTEMPLATE_HH_
+#define IGNITION_PHYSICS_SDF_CONSTRUCTMODELTEMPLATE_HH_
+
+#include <string>
+
+#include <sdf/Model.hh>
+
+#include <ignition/physics/FeatureList.hh>
+#include <ignition/physics/Geometry.hh>
+
+namespace ignition {
+namespace physics {
+namespace sdf {
+
+/// \brief Lets an engine turn an SDF model into a template once, and then
+/// construct any number of copies of it. Constructing a copy skips the SDF
+/// entirely, which makes spawning many identical models much cheaper than
+/// calling ConstructModel for each of them.
+class ConstructSdfModelTemplate : public virtual Feature
+{
+  public: template <typename PolicyT, typename FeaturesT>
+  class Engine : public virtual Feature::Engine<PolicyT, FeaturesT>
+  {
+    /// \brief Build a template from an SDF model. The template is kept until
+    /// the engine is destroyed.
+    /// \param[in] _model
+    ///   The model to build the template from
+    /// \return The ID of the template, to be passed to
+    /// World::ConstructModelFromTemplate().
+    public: std::size_t ConstructModelTemplate(const ::sdf::Model &_model);
+  };
+
+  public: template <typename PolicyT, typename FeaturesT>
+  class World : public virtual Feature::World<PolicyT, FeaturesT>
+  {
+    public: using ModelPtrType = ModelPtr<PolicyT, FeaturesT>;
+
+    public: using PoseType =
+        typename FromPolicy<PolicyT>::template Use<Pose>;
+
+    /// \brief Construct a copy of a model template in this world.
+    /// \param[in] _templateID
+    ///   ID that was returned by Engine::ConstructModelTemplate()
+    /// \param[in] _name
+    ///   Name of the new model
+    /// \param[in] _pose
+    ///   Pose of the model frame of the new model, which replaces the pose
+    ///   of the SDF model
+    /// \return The new model, or a null model if _templateID does not refer
+    /// to a template of this engine.
+    public: ModelPtrType ConstructModelFromTemplate(
+        std::size_t _templateID,
+        const std::string &_name,
+        const PoseType &_pose);
+  };
+
+  public: template <typename PolicyT>
+  class Implementation : public virtual Feature::Implementation<PolicyT>
+  {
+    public: using PoseType =
+        typename FromPolicy<PolicyT>::template Use<Pose>;
+
+    public: virtual std::size_t ConstructSdfModelTemplate(
+        const Identity &_engineID, const ::sdf::Model &_model) = 0;
+
+    public: virtual Identity ConstructModelFromTemplate(
+        const Identity &_worldID,
+        std::size_t _templateID,
+        const std::string &_name,
+        const PoseType &_pose) = 0;
+  };
+};
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+std::size_t ConstructSdfModelTemplate::Engine<PolicyT, FeaturesT>::
+ConstructModelTemplate(const ::sdf::Model &_model)
+{
+  return this->template Interface<ConstructSdfModelTemplate>()
+      ->ConstructSdfModelTemplate(this->identity, _model);
+}
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+auto ConstructSdfModelTemplate::World<PolicyT, FeaturesT>::
+ConstructModelFromTemplate(
+    const std::size_t _templateID,
+    const std::string &_name,
+    const PoseType &_pose) -> ModelPtrType
+{
+  return ModelPtrType(this->pimpl,
+        this->template Interface<ConstructSdfModelTemplate>()
+            ->ConstructModelFromTemplate(
+              this->identity, _templateID, _name, _pose));
+}
+
+}
+}
+}
+
+#endif
@@ -44,6 +44,47 @@ class ConstructSdfWorld : public virtual Feature
   };
 };
 
+/// \brief Lets an engine construct the models of an SDF world concurrently.
+///
+/// The engine builds the models on a pool of worker threads and then adds
+/// them to the world one at a time, in the order of the SDF. The entity IDs
+/// of the world and of everything in it are therefore the same no matter how
+/// many threads are used, including when only one is used.
+///
+/// Thread-safety contract: ConstructWorld blocks until the world is
+/// complete, and no other function may be called on the engine or on any of
+/// its entities while it runs.
+class ParallelConstructSdfWorld
+    : public virtual FeatureWithRequirements<ConstructSdfWorld>
+{
+  public: template <typename PolicyT, typename FeaturesT>
+  class Engine : public virtual Feature::Engine<PolicyT, FeaturesT>
+  {
+    /// \brief Set the maximum number of threads that ConstructWorld may use
+    /// to build the models of a world, including the calling thread.
+    /// \param[in] _count
+    ///   The number of threads. The default of 1 builds every model on the
+    ///   calling thread. A value of 0 lets the engine pick a number based on
+    ///   the hardware concurrency.
+    public: void SetConstructWorldThreadCount(std::size_t _count);
+
+    /// \brief Get the maximum number of threads that ConstructWorld may use.
+    /// A value of 0 means the engine picks a number based on the hardware
+    /// concurrency.
+    public: std::size_t GetConstructWorldThreadCount() const;
+  };
+
+  public: template <typename PolicyT>
+  class Implementation : public virtual Feature::Implementation<PolicyT>
+  {
+    public: virtual void SetEngineConstructWorldThreadCount(
+        const Identity &_engineID, std::size_t _count) = 0;
+
+    public: virtual std::size_t GetEngineConstructWorldThreadCount(
+        const Identity &_engineID) const = 0;
+  };
+};
+
 /////////////////////////////////////////////////
 template <typename PolicyT, typename FeaturesT>
 auto ConstructSdfWorld::Engine<PolicyT, FeaturesT>::ConstructWorld(
@@ -54,6 +95,24 @@ auto ConstructSdfWorld::Engine<PolicyT, FeaturesT>::ConstructWorld(
             ->ConstructSdfWorld(this->identity, _world));
 }
 
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+void ParallelConstructSdfWorld::Engine<PolicyT, FeaturesT>::
+SetConstructWorldThreadCount(const std::size_t _count)
+{
+  this->template Interface<ParallelConstructSdfWorld>()
+      ->SetEngineConstructWorldThreadCount(this->identity, _count);
+}
+
+/////////////////////////////////////////////////
+template <typename PolicyT, typename FeaturesT>
+std::size_t ParallelConstructSdfWorld::Engine<PolicyT, FeaturesT>::
+GetConstructWorldThreadCount() const
+{
+  return this->template Interface<ParallelConstructSdfWorld>()
+      ->GetEngineConstructWorldThreadCount(this->identity);
+}
+
 }
 }
 }
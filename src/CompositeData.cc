@@ -16,6 +16,8 @@
 */
 
 #include <cassert>
+#include <utility>
+#include <vector>
 
 #include "ignition/physics/CompositeData.hh"
 
@@ -28,25 +30,25 @@ namespace ignition
     /// \brief Mark an entry as unqueried and decrement the query counter if
     /// the entry was originally marked as queried
     static void RemoveQuery(
-        const CompositeData::MapOfData::iterator &_it, std::size_t &_numQueries)
+        CompositeData::DataEntry &_entry, std::size_t &_numQueries)
     {
-      if (_it->second.queried)
+      if (_entry.queried)
       {
         --_numQueries;
-        _it->second.queried = false;
+        _entry.queried = false;
       }
     }
 
     /////////////////////////////////////////////////
-    /// \brief Remove an entry from a map and adjust the counters
+    /// \brief Remove the data of an entry and adjust the counters
     static void RemoveEntryUnlessRequired(
-        const CompositeData::MapOfData::iterator &_receiver,
+        CompositeData::DataEntry &_receiver,
         std::size_t &_numEntries, std::size_t &_numQueries)
     {
-      if (!_receiver->second.required)
+      if (!_receiver.required)
       {
         // If the data isn't required, delete it
-        _receiver->second.data.reset();
+        _receiver.Reset();
         --_numEntries;
         RemoveQuery(_receiver, _numQueries);
       }
@@ -55,62 +57,32 @@ namespace ignition
     /////////////////////////////////////////////////
     /// \brief Use this to copy data efficiently from one existing data instance
     /// to another existing data instance
-    template <typename SenderType>
     static void StandardDataCopy(
-        const CompositeData::MapOfData::iterator &_receiver,
-        SenderType _sender,
+        CompositeData::DataEntry &_receiver,
+        const CompositeData::DataEntry &_sender,
         const bool _mergeRequirements,
-        std::size_t &/*_numEntries*/,
-        std::size_t &/*_numQueries*/)
+        std::size_t &/*_numEntries*/)
     {
-      _receiver->second.data->Copy(*_sender->second.data);
-      if (_mergeRequirements && _sender->second.required)
-        _receiver->second.required = true;
+      _receiver.data->Copy(*_sender.data);
+      if (_mergeRequirements && _sender.required)
+        _receiver.required = true;
     }
 
     /////////////////////////////////////////////////
-    /// \brief Use this to clone data into a map entry which has an entry for
-    /// the data type but does not currently have an instance
-    template <typename SenderType>
+    /// \brief Use this to clone data into an entry which does not currently
+    /// have an instance
     static void StandardDataClone(
-        const CompositeData::MapOfData::iterator &_receiver,
-        SenderType _sender,
+        CompositeData::DataEntry &_receiver,
+        const CompositeData::DataEntry &_sender,
         const bool _mergeRequirements,
-        std::size_t &_numEntries,
-        std::size_t &/*_numQueries*/)
+        std::size_t &_numEntries)
     {
-      assert(!_receiver->second.data &&
+      assert(!_receiver.data &&
              "Calling StandardCloneData on a data entry that already exists. "
              "This should not be possible! Please report this bug!");
 
-      _receiver->second = CompositeData::DataEntry(
-            _sender->second.data->Clone(),
-            _mergeRequirements && _sender->second.required);
-
-      ++_numEntries;
-    }
-
-    /////////////////////////////////////////////////
-    /// \brief Use this to create a new data entry and instance for a map which
-    /// did not previously contain an entry for the data type
-    template <typename SenderType>
-    static void StandardDataCreate(
-        CompositeData::MapOfData &_toMap,
-        SenderType _sender,
-        const bool _mergeRequirements,
-        std::size_t &_numEntries)
-    {
-      const bool inserted = _toMap.insert(
-            std::make_pair(
-              _sender->first,
-              CompositeData::DataEntry(
-                _sender->second.data->Clone(),
-                _mergeRequirements && _sender->second.required))).second;
-
-      (void)(inserted);
-      assert(inserted &&
-             "Calling StandardDataCreate on a data entry that already exists. "
-             "This should not be possible! Please report this bug!");
+      _receiver.CloneFrom(_sender);
+      _receiver.required = _mergeRequirements && _sender.required;
 
       ++_numEntries;
     }
@@ -118,58 +90,23 @@ namespace ignition
     /////////////////////////////////////////////////
     /// \brief Use move semantics for a more efficient version of
     /// StandardDataCopy and StandardDataClone
-    template <typename SenderType>
     static void MoveData(
-        const CompositeData::MapOfData::iterator &_receiver,
-        SenderType _sender,
-        const bool _mergeRequirements,
-        std::size_t &_numEntries,
-        std::size_t &/*_numQueries*/)
-    {
-      if (!_receiver->second.data)
-        ++_numEntries;
-
-      _receiver->second.data.reset(_sender->second.data.release());
-      _receiver->second.required =
-          _mergeRequirements && _sender->second.required;
-    }
-
-    /////////////////////////////////////////////////
-    /// \brief Use move semantics for a more efficient version of
-    /// StandardDataCreate
-    template <typename SenderType>
-    static void MoveDataCreate(
-        CompositeData::MapOfData &_toMap,
-        SenderType _sender,
+        CompositeData::DataEntry &_receiver,
+        CompositeData::DataEntry &_sender,
         const bool _mergeRequirements,
         std::size_t &_numEntries)
     {
-      const bool inserted = _toMap.insert(
-            std::make_pair(
-              _sender->first,
-              CompositeData::DataEntry(
-                std::unique_ptr<Cloneable>(_sender->second.data.release()),
-                _mergeRequirements && _sender->second.required))).second;
-
-      (void)(inserted);
-      assert(inserted &&
-             "Calling MoveDataCreate on a data entry that already exists. This "
-             "should not be possible! Please report this bug!");
+      if (!_receiver.data)
+        ++_numEntries;
 
-      ++_numEntries;
+      _receiver.MoveFrom(_sender);
+      _receiver.required = _mergeRequirements && _sender.required;
     }
 
     /////////////////////////////////////////////////
     template <typename SenderType>
     using DataTransferFnc = void(*)(
-            const CompositeData::MapOfData::iterator&,
-            SenderType, const bool, std::size_t&, std::size_t&);
-
-    /////////////////////////////////////////////////
-    template <typename SenderType>
-    using DataCreateFnc = void(*)(
-            CompositeData::MapOfData&,
-            SenderType, const bool, std::size_t&);
+            CompositeData::DataEntry&, SenderType, const bool, std::size_t&);
 
     /////////////////////////////////////////////////
     template <typename SenderType, typename FromMapType>
@@ -177,91 +114,71 @@ namespace ignition
         std::size_t &_numEntries,
         std::size_t &_numQueries,
         CompositeData::MapOfData &_toMap,
-        FromMapType _fromMap,
+        FromMapType &_fromMap,
         const bool _mergeData,
         const bool _mergeRequirements,
         DataTransferFnc<SenderType> CopyDataFnc,
-        DataTransferFnc<SenderType> CloneDataFnc,
-        DataCreateFnc<SenderType> CreateDataFnc)
+        DataTransferFnc<SenderType> CloneDataFnc)
     {
-      CompositeData::MapOfData::iterator receiver = _toMap.begin();
-      auto sender = _fromMap.begin();
+      // Both maps keep their entries sorted by the same ordering, so we can
+      // walk through them side by side.
+      std::vector<CompositeData::DataEntry*> &receivers = _toMap.sortedEntries;
+      std::size_t r = 0;
 
-      while (_fromMap.end() != sender)
+      for (CompositeData::DataEntry *sender : _fromMap.sortedEntries)
       {
-        if (_toMap.end() == receiver)
+        while (r < receivers.size()
+               && detail::TypeKeyLess(receivers[r]->key, sender->key))
         {
-          // If we've reached the end of this CompositeData's map, then we
-          // should just add each remaining entry from sender. We don't have to
-          // worry about conflicts, because this CompositeData cannot already
-          // have any of these types.
-          CreateDataFnc(_toMap, sender, _mergeRequirements, _numEntries);
+          // If the receiver has some data that the sender does not...
+          if (!_mergeData && receivers[r]->data)
+          {
+            RemoveEntryUnlessRequired(*receivers[r], _numEntries, _numQueries);
+          }
 
-          ++sender;
+          ++r;
         }
-        else if (receiver->first == sender->first)
+
+        const bool matched = r < receivers.size()
+            && detail::TypeKeyEqual(receivers[r]->key, sender->key);
+
+        if (!sender->data)
         {
-          if (sender->second.data)
+          // If the sender does not have an object at this entry...
+          if (matched && !_mergeData && receivers[r]->data)
           {
-            // If the sender has an entry whose key matches this one...
-
-            if (receiver->second.data)
-            {
-              // If we already have an instance, we should copy instead of
-              // allocating a clone
-              CopyDataFnc(receiver, sender, _mergeRequirements,
-                          _numEntries, _numQueries);
-            }
-            else if (!receiver->second.data)
-            {
-              assert(!receiver->second.queried &&
-                     "An entry which was supposed to be empty is marked as "
-                     "queried. This should be impossible!");
-
-              // If we don't already have an instance, we should clone it.
-              CloneDataFnc(receiver, sender, _mergeRequirements,
-                           _numEntries, _numQueries);
-            }
+            RemoveEntryUnlessRequired(*receivers[r], _numEntries, _numQueries);
           }
-          else
-          {
-            // If the sender does not have an object at this entry...
-
-            if (!_mergeData)
-            {
-              RemoveEntryUnlessRequired(receiver, _numEntries, _numQueries);
-            }
 
-            // Note that this data cannot be required by the sender if they do
-            // not have it, so we do not need to worry about changing the
-            // requirement flag.
-          }
+          // Note that this data cannot be required by the sender if they do
+          // not have it, so we do not need to worry about changing the
+          // requirement flag.
+          if (matched)
+            ++r;
 
-          ++sender;
-          ++receiver;
+          continue;
         }
-        else if (receiver->first < sender->first)
-        {
-          // If the receiver has some data that the sender does not...
 
-          if (!_mergeData)
-          {
-            RemoveEntryUnlessRequired(receiver, _numEntries, _numQueries);
-          }
+        // If the receiving map does not contain an entry that matches this
+        // entry of the sending map, then the entry must be created.
+        CompositeData::DataEntry &receiver =
+            matched ? *receivers[r] : _toMap.Insert(sender->key, r);
+        ++r;
 
-          ++receiver;
+        if (receiver.data)
+        {
+          // If we already have an instance, we should copy instead of
+          // allocating a clone
+          CopyDataFnc(receiver, *sender, _mergeRequirements, _numEntries);
         }
         else
         {
-          if (sender->second.data)
-          {
-            // If the receiver has a higher key value, then the receiving map
-            // does not contain an entry that matches this entry of the sending
-            // map, and therefore the entry must be created.
-            CreateDataFnc(_toMap, sender, _mergeRequirements, _numEntries);
-          }
+          assert(!receiver.queried &&
+                 "An entry which was supposed to be empty is marked as "
+                 "queried. This should be impossible!");
 
-          ++sender;
+          // If we don't already have an instance, we should clone it.
+          CloneDataFnc(receiver, *sender, _mergeRequirements, _numEntries);
         }
       }
 
@@ -269,10 +186,10 @@ namespace ignition
       {
         // Remove any remaining data structures in the receiver which do not
         // correspond to any entries that were in the sender.
-        while (_toMap.end() != receiver)
+        for (; r < receivers.size(); ++r)
         {
-          RemoveEntryUnlessRequired(receiver, _numEntries, _numQueries);
-          ++receiver;
+          if (receivers[r]->data)
+            RemoveEntryUnlessRequired(*receivers[r], _numEntries, _numQueries);
         }
       }
     }
@@ -297,7 +214,7 @@ namespace ignition
     /////////////////////////////////////////////////
     std::size_t CompositeData::EntryCount() const
     {
-      assert(numEntries <= dataMap.size() &&
+      assert(numEntries <= dataMap.entries.size() &&
              "The recorded number of entries is greater than the size of the "
              "dataMap, but that should be impossible!");
       return numEntries;
@@ -317,8 +234,18 @@ namespace ignition
     {
       numQueries = 0;
 
-      for (auto &entry : dataMap)
-        entry.second.queried = false;
+      for (const auto &entry : dataMap.entries)
+        entry.queried = false;
+    }
+
+    /////////////////////////////////////////////////
+    void CompositeData::Clear()
+    {
+      for (auto &entry : dataMap.entries)
+      {
+        if (entry.data)
+          RemoveEntryUnlessRequired(entry, numEntries, numQueries);
+      }
     }
 
     /////////////////////////////////////////////////
@@ -329,10 +256,10 @@ namespace ignition
 
       std::set<std::string> entries;
 
-      for (const auto &entry : dataMap)
+      for (const auto &entry : dataMap.entries)
       {
-        if (entry.second.data)
-          entries.insert(entries.end(), entry.first);
+        if (entry.data)
+          entries.insert(entry.key.label);
       }
 
       return entries;
@@ -346,10 +273,10 @@ namespace ignition
 
       std::set<std::string> unqueried;
 
-      for (const auto &entry : dataMap)
+      for (const auto &entry : dataMap.entries)
       {
-        if (entry.second.data && !entry.second.queried)
-          unqueried.insert(unqueried.end(), entry.first);
+        if (entry.data && !entry.queried)
+          unqueried.insert(entry.key.label);
       }
 
       return unqueried;
@@ -360,14 +287,13 @@ namespace ignition
         const CompositeData &_other,
         const bool _mergeRequirements)
     {
-      using SenderType = CompositeData::MapOfData::const_iterator;
-      CopyMapData<SenderType, const CompositeData::MapOfData&>(
+      using SenderType = const CompositeData::DataEntry&;
+      CopyMapData<SenderType, const CompositeData::MapOfData>(
             numEntries, numQueries,
             this->dataMap, _other.dataMap,
             false, _mergeRequirements,
-            &StandardDataCopy<SenderType>,
-            &StandardDataClone<SenderType>,
-            &StandardDataCreate<SenderType>);
+            &StandardDataCopy,
+            &StandardDataClone);
 
       return *this;
     }
@@ -377,14 +303,13 @@ namespace ignition
         CompositeData &&_other,
         const bool _mergeRequirements)
     {
-      using SenderType = CompositeData::MapOfData::iterator;
-      CopyMapData<SenderType, CompositeData::MapOfData&&>(
+      using SenderType = CompositeData::DataEntry&;
+      CopyMapData<SenderType, CompositeData::MapOfData>(
             numEntries, numQueries,
-            this->dataMap, std::move(_other.dataMap),
+            this->dataMap, _other.dataMap,
             false, _mergeRequirements,
-            &MoveData<SenderType>,
-            &MoveData<SenderType>,
-            &MoveDataCreate<SenderType>);
+            &MoveData,
+            &MoveData);
 
       return *this;
     }
@@ -394,14 +319,13 @@ namespace ignition
         const CompositeData &_other,
         const bool _mergeRequirements)
     {
-      using SenderType = CompositeData::MapOfData::const_iterator;
-      CopyMapData<SenderType, const CompositeData::MapOfData&>(
+      using SenderType = const CompositeData::DataEntry&;
+      CopyMapData<SenderType, const CompositeData::MapOfData>(
             numEntries, numQueries,
             this->dataMap, _other.dataMap,
             true, _mergeRequirements,
-            &StandardDataCopy<SenderType>,
-            &StandardDataClone<SenderType>,
-            &StandardDataCreate<SenderType>);
+            &StandardDataCopy,
+            &StandardDataClone);
 
       return *this;
     }
@@ -411,14 +335,13 @@ namespace ignition
         CompositeData &&_other,
         const bool _mergeRequirements)
     {
-      using SenderType = CompositeData::MapOfData::iterator;
-      CopyMapData<SenderType, CompositeData::MapOfData&&>(
+      using SenderType = CompositeData::DataEntry&;
+      CopyMapData<SenderType, CompositeData::MapOfData>(
             numEntries, numQueries,
-            this->dataMap, std::move(_other.dataMap),
+            this->dataMap, _other.dataMap,
             true, _mergeRequirements,
-            &MoveData<SenderType>,
-            &MoveData<SenderType>,
-            &MoveDataCreate<SenderType>);
+            &MoveData,
+            &MoveData);
 
       return *this;
     }
@@ -450,22 +373,97 @@ namespace ignition
     }
 
     /////////////////////////////////////////////////
-    CompositeData::DataEntry::DataEntry()
-      : required(false),
-        queried(false)
+    CompositeData::DataEntry::DataEntry(const TypeKey &_key)
+      : key(_key),
+        data(nullptr),
+        required(false),
+        queried(false),
+        ops(nullptr),
+        heap(nullptr)
     {
       // Do nothing
     }
 
     /////////////////////////////////////////////////
-    CompositeData::DataEntry::DataEntry(
-        std::unique_ptr<Cloneable> &&_data,
-        bool _required)
-      : data(std::move(_data)),
-        required(_required),
-        queried(false)
+    CompositeData::DataEntry::~DataEntry()
     {
-      // Do nothing
+      this->Reset();
+
+      if (this->heap)
+        this->ops->deallocate(this->heap);
+    }
+
+    /////////////////////////////////////////////////
+    void CompositeData::DataEntry::Reset()
+    {
+      if (!this->data)
+        return;
+
+      this->data->~Cloneable();
+      this->data = nullptr;
+    }
+
+    /////////////////////////////////////////////////
+    void CompositeData::DataEntry::CloneFrom(const DataEntry &_other)
+    {
+      assert(!this->data && _other.data);
+
+      if (!this->ops)
+        this->ops = _other.ops;
+
+      this->data = this->ops->copyConstruct(this->Storage(), *_other.data);
+    }
+
+    /////////////////////////////////////////////////
+    void CompositeData::DataEntry::MoveFrom(DataEntry &_other)
+    {
+      assert(_other.data);
+
+      if (this == &_other)
+        return;
+
+      this->Reset();
+      if (_other.ops->storesInline)
+      {
+        // Inline data is trivially copyable, so copying it is as good as
+        // moving it.
+        this->CloneFrom(_other);
+        _other.Reset();
+      }
+      else
+      {
+        // Trade memory with _other, so that neither entry needs to allocate
+        // for its next data instance if it already had memory.
+        std::swap(this->ops, _other.ops);
+        std::swap(this->heap, _other.heap);
+        this->data = _other.data;
+        _other.data = nullptr;
+      }
+    }
+
+    /////////////////////////////////////////////////
+    void *CompositeData::DataEntry::Storage()
+    {
+      if (this->ops->storesInline)
+        return this->buffer;
+
+      if (!this->heap)
+        this->heap = this->ops->allocate();
+
+      return this->heap;
+    }
+
+    /////////////////////////////////////////////////
+    CompositeData::DataEntry &CompositeData::MapOfData::Insert(
+        const TypeKey &_key, const std::size_t _position)
+    {
+      this->entries.emplace_back(_key);
+      DataEntry &entry = this->entries.back();
+      this->sortedEntries.insert(
+            this->sortedEntries.begin()
+              + static_cast<std::ptrdiff_t>(_position),
+            &entry);
+      return entry;
     }
   }
 }
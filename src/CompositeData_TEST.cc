@@ -17,10 +17,40 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <string>
+
 #include "ignition/physics/CompositeData.hh"
 #include "utils/TestDataTypes.hh"
 
+#include <test/Utils.hh>
+
 using ignition::physics::CompositeData;
+using ignition::physics::test::AllocationCount;
+
+/////////////////////////////////////////////////
+// Count the heap allocations of this test, so that we can check which
+// operations of CompositeData allocate memory.
+void *operator new(std::size_t _size)
+{
+  ++ignition::physics::test::AllocationCounter();
+  if (void *memory = std::malloc(_size == 0 ? 1 : _size))
+    return memory;
+
+  throw std::bad_alloc();
+}
+
+void operator delete(void *_memory) noexcept
+{
+  std::free(_memory);
+}
+
+void operator delete(void *_memory, std::size_t) noexcept
+{
+  std::free(_memory);
+}
 
 /////////////////////////////////////////////////
 TEST(CompositeData_TEST, DestructorCoverage)
@@ -131,6 +161,49 @@ TEST(CompositeData_TEST, InsertOrAssign)
   // one in physical memory, even though its value has changed.
   EXPECT_EQ(&data.Get<StringData>(), &secondResult.data);
   EXPECT_EQ(&result.data, &secondResult.data);
+  EXPECT_EQ(1u, data.EntryCount());
+}
+
+/////////////////////////////////////////////////
+TEST(CompositeData_TEST, InsertOrAssignFromItself)
+{
+  CompositeData data;
+  const std::string value = "a string which is too long to be stored inline";
+  StringData &original = data.Insert<StringData>(value).data;
+
+  // The arguments refer to the entry which gets replaced
+  CompositeData::InsertResult<StringData> result =
+      data.InsertOrAssign<StringData>(data.Get<StringData>().myString);
+  EXPECT_FALSE(result.inserted);
+  EXPECT_EQ(value, result.data.myString);
+  EXPECT_EQ(&original, &result.data);
+  EXPECT_EQ(1u, data.EntryCount());
+}
+
+/////////////////////////////////////////////////
+class ThrowingData
+{
+  public: int myInt;
+
+  public: explicit ThrowingData(const int _input = 0)
+    : myInt(_input)
+  {
+    if (_input < 0)
+      throw std::invalid_argument("negative input");
+  }
+};
+
+/////////////////////////////////////////////////
+TEST(CompositeData_TEST, InsertOrAssignThrows)
+{
+  CompositeData data;
+  data.Insert<ThrowingData>(5);
+
+  // A failed assignment leaves the old value in place
+  EXPECT_THROW(data.InsertOrAssign<ThrowingData>(-1), std::invalid_argument);
+  ASSERT_TRUE(data.Has<ThrowingData>());
+  EXPECT_EQ(5, data.Get<ThrowingData>().myInt);
+  EXPECT_EQ(1u, data.EntryCount());
 }
 
 /////////////////////////////////////////////////
@@ -580,6 +653,133 @@ TEST(CompositeData_TEST, Queries)
   EXPECT_NE(0u, all.count(typeid(BoolData).name()));
 }
 
+/////////////////////////////////////////////////
+TEST(CompositeData_TEST, InlineStorage)
+{
+  using DataEntry = ignition::physics::CompositeData::DataEntry;
+  static_assert(DataEntry::StoresInline<IntData>(),
+                "IntData should be stored inline");
+  static_assert(!DataEntry::StoresInline<StringData>(),
+                "StringData should be stored on the heap");
+
+  ignition::physics::CompositeData data;
+  IntData &intData = data.Get<IntData>();
+  StringData &stringData = data.Get<StringData>();
+  intData.myInt = 7;
+  stringData.myString = "inline";
+
+  // Adding more types must not move the data that already exists, because
+  // references to it may be held (e.g. by ExpectData)
+  AddSomeData<DoubleData, FloatData, BoolData, CharData, VectorDoubleData>
+      ::To(data);
+  EXPECT_EQ(7u, data.EntryCount());
+  EXPECT_EQ(&intData, &data.Get<IntData>());
+  EXPECT_EQ(&stringData, &data.Get<StringData>());
+  EXPECT_EQ(7, data.Get<IntData>().myInt);
+  EXPECT_EQ("inline", data.Get<StringData>().myString);
+
+  // Copies must hold their own instances of both inline and heap data
+  ignition::physics::CompositeData copy(data);
+  EXPECT_EQ(7u, copy.EntryCount());
+  EXPECT_EQ(7, copy.Get<IntData>().myInt);
+  EXPECT_EQ("inline", copy.Get<StringData>().myString);
+  EXPECT_NE(&intData, &copy.Get<IntData>());
+  EXPECT_NE(&stringData, &copy.Get<StringData>());
+
+  copy.Get<IntData>().myInt = 8;
+  EXPECT_EQ(7, data.Get<IntData>().myInt);
+
+  ignition::physics::CompositeData moved(std::move(copy));
+  EXPECT_EQ(7u, moved.EntryCount());
+  EXPECT_EQ(8, moved.Get<IntData>().myInt);
+  EXPECT_EQ("inline", moved.Get<StringData>().myString);
+
+  // Inline data which gets removed is constructed anew by the next Get
+  EXPECT_TRUE(data.Remove<IntData>());
+  EXPECT_FALSE(data.Has<IntData>());
+  EXPECT_EQ(55, data.Get<IntData>().myInt);
+}
+
+/////////////////////////////////////////////////
+TEST(CompositeData_TEST, Clear)
+{
+  CompositeData data;
+  AddSomeData<StringData, DoubleData, IntData>::To(data);
+  data.MakeRequired<DoubleData>();
+
+  data.Clear();
+  EXPECT_EQ(1u, data.EntryCount());
+  EXPECT_EQ(0u, data.UnqueriedEntryCount());
+  EXPECT_FALSE(data.Has<StringData>());
+  EXPECT_FALSE(data.Has<IntData>());
+  EXPECT_TRUE(data.Has<DoubleData>());
+
+  // The data gets constructed anew after being cleared
+  EXPECT_EQ("default", data.Get<StringData>().myString);
+  EXPECT_EQ(55, data.Get<IntData>().myInt);
+
+  RequireIntDouble specified;
+  specified.Get<StringData>().myString = "expected";
+  specified.Get<IntData>().myInt = 3;
+  specified.Clear();
+  EXPECT_FALSE(specified.Has<StringData>());
+  EXPECT_EQ(3, specified.Get<IntData>().myInt);
+  EXPECT_EQ("default", specified.Get<StringData>().myString);
+}
+
+/////////////////////////////////////////////////
+TEST(CompositeData_TEST, ReuseWithoutAllocating)
+{
+  // Make sure that we are counting allocations at all
+  const std::size_t initialCount = AllocationCount();
+  CreateSomeData<StringData>();
+  EXPECT_LT(initialCount, AllocationCount());
+
+  CompositeData output;
+  CompositeData copy;
+  RequireIntDouble specified;
+  VectorDoubleData &vectorData = output.Get<VectorDoubleData>();
+  output.MakeRequired<VectorDoubleData>();
+
+  // Fill in the same data over and over again, like a physics engine would
+  // for each simulation step
+  auto step = [&](const int _step)
+  {
+    output.Clear();
+    specified.Clear();
+
+    // Short strings do not allocate
+    output.Get<StringData>().myString = "step";
+    output.Get<IntData>().myInt = _step;
+    output.InsertOrAssign<BoolData>(_step % 2 == 0);
+    if (_step % 3 == 0)
+      output.Get<DoubleData>().myDouble = _step;
+
+    specified.Get<IntData>().myInt = _step;
+    specified.Get<StringData>().myString = "expected";
+
+    // Required data is never cleared, so it keeps the memory that it
+    // allocates itself
+    vectorData.myVector.assign(5, static_cast<double>(_step));
+
+    copy = output;
+    EXPECT_EQ(_step, copy.Get<IntData>().myInt);
+  };
+
+  // The first steps allocate memory for each data type
+  for (int i = 0; i < 3; ++i)
+    step(i);
+
+  const std::size_t warmCount = AllocationCount();
+  for (int i = 3; i < 100; ++i)
+    step(i);
+
+  EXPECT_EQ(warmCount, AllocationCount());
+  EXPECT_EQ(99, output.Get<IntData>().myInt);
+  EXPECT_EQ(99.0, output.Get<DoubleData>().myDouble);
+  EXPECT_EQ(5u, output.Get<VectorDoubleData>().myVector.size());
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
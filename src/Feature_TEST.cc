@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <stdexcept>
+
 #include <ignition/physics/RequestEngine.hh>
 #include <ignition/physics/Entity.hh>
 
@@ -115,6 +117,116 @@ TEST(Feature_TEST, SimpleMock)
   EXPECT_EQ(3u, missing.size());
 }
 
+/////////////////////////////////////////////////
+TEST(Feature_TEST, BorrowedEntities)
+{
+  using MockList = FeatureList<LinkMockFeature>;
+
+  class BogusImplementation : detail::Implementation
+  {
+    public: Identity Generate(
+        std::size_t _id, const std::shared_ptr<void> &_ref) const
+    {
+      return this->Implementation::GenerateIdentity(_id, _ref);
+    }
+
+    public: Identity GenerateBorrowed(std::size_t _id, void *_ref) const
+    {
+      return this->Implementation::GenerateBorrowedIdentity(_id, _ref);
+    }
+  };
+
+  BogusImplementation bogus;
+  auto pimpl = std::make_shared<Entity<FeaturePolicy3d, MockList>::Pimpl>();
+  auto object = std::make_shared<int>(0);
+
+  const Identity owning = bogus.Generate(1, object);
+  EXPECT_FALSE(owning.Borrowed());
+  EXPECT_EQ(2, object.use_count());
+
+  // Borrowed identities point at the object without owning it
+  const Identity borrowed = bogus.GenerateBorrowed(1, object.get());
+  EXPECT_TRUE(borrowed.Borrowed());
+  EXPECT_EQ(object.get(), borrowed.ref.get());
+  EXPECT_EQ(2, object.use_count());
+
+  const Identity borrowedCopy = owning.Borrow();
+  EXPECT_TRUE(borrowedCopy.Borrowed());
+  EXPECT_EQ(owning.id, borrowedCopy.id);
+  EXPECT_EQ(object.get(), borrowedCopy.ref.get());
+  EXPECT_EQ(2, object.use_count());
+
+  // An identity without a reference is not considered to be borrowed
+  EXPECT_FALSE(bogus.Generate(2, nullptr).Borrowed());
+
+  Link3dPtr<MockList> link(pimpl, owning);
+  ASSERT_TRUE(link);
+  EXPECT_FALSE(link->FullIdentity().Borrowed());
+  EXPECT_EQ(2, pimpl.use_count());
+  EXPECT_EQ(3, object.use_count());
+
+  // Neither a borrowed EntityPtr nor its copies should change any reference
+  // count.
+  Link3dPtr<MockList> borrowedLink = link.Borrow();
+  ASSERT_TRUE(borrowedLink);
+  EXPECT_TRUE(borrowedLink->FullIdentity().Borrowed());
+  EXPECT_EQ(link, borrowedLink);
+  EXPECT_EQ(link->EntityID(), borrowedLink->EntityID());
+  EXPECT_TRUE(borrowedLink->MockALinkFunction());
+
+  Link3dPtr<MockList> borrowedLinkCopy = borrowedLink;
+  ASSERT_TRUE(borrowedLinkCopy);
+  EXPECT_TRUE(borrowedLinkCopy->FullIdentity().Borrowed());
+  EXPECT_EQ(2, pimpl.use_count());
+  EXPECT_EQ(3, object.use_count());
+
+  // Borrowing an invalid EntityPtr gives back an invalid EntityPtr
+  EXPECT_FALSE(Link3dPtr<MockList>().Borrow());
+}
+
+/////////////////////////////////////////////////
+TEST(Feature_TEST, BorrowedGeneration)
+{
+  class BogusImplementation : detail::Implementation
+  {
+    public: Identity GenerateBorrowed(
+        std::size_t _id, void *_ref, std::size_t _generation) const
+    {
+      return this->Implementation::GenerateBorrowedIdentity(
+            _id, _ref, _generation);
+    }
+
+    public: void *Get(const Identity &_identity) const
+    {
+      return this->Reference(_identity).get();
+    }
+
+    protected: bool IsCurrentGeneration(
+        const Identity &_identity) const override
+    {
+      return _identity.generation == this->currentGeneration;
+    }
+
+    public: std::size_t currentGeneration = 1;
+  };
+
+  BogusImplementation bogus;
+  int object = 0;
+
+  const Identity checked = bogus.GenerateBorrowed(1, &object, 1);
+  const Identity unchecked = bogus.GenerateBorrowed(1, &object, 0);
+  EXPECT_EQ(1u, checked.generation);
+  EXPECT_EQ(1u, checked.Borrow().generation);
+  EXPECT_EQ(&object, bogus.Get(checked));
+  EXPECT_EQ(&object, bogus.Get(unchecked));
+
+  // Once the entity is replaced, only the unchecked identity can be used
+  bogus.currentGeneration = 2;
+  EXPECT_THROW(bogus.Get(checked), std::out_of_range);
+  EXPECT_THROW(bogus.Get(checked.Borrow()), std::out_of_range);
+  EXPECT_EQ(&object, bogus.Get(unchecked));
+}
+
 int main(int argc, char *argv[])
 {
   ::testing::InitGoogleTest(&argc, argv);
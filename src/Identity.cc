@@ -15,6 +15,9 @@
  *
 */
 
+#include <stdexcept>
+#include <string>
+
 #include <ignition/physics/Entity.hh>
 
 namespace ignition
@@ -31,6 +34,20 @@ namespace ignition
         return Identity(_id, _ref);
       }
 
+      /////////////////////////////////////////////////
+      Identity Implementation::GenerateBorrowedIdentity(
+          std::size_t _id,
+          void *_ref,
+          std::size_t _generation) const
+      {
+        // The aliasing constructor of an empty shared_ptr creates a pointer to
+        // _ref that has no control block, so it has no reference count to
+        // update when it gets copied.
+        return Identity(
+              _id, std::shared_ptr<void>(std::shared_ptr<void>(), _ref),
+              _generation);
+      }
+
       /////////////////////////////////////////////////
       Identity Implementation::GenerateInvalidId() const
       {
@@ -41,8 +58,21 @@ namespace ignition
       const std::shared_ptr<void> &Implementation::Reference(
           const Identity &_identity) const
       {
+        if (_identity.generation != 0 && !this->IsCurrentGeneration(_identity))
+        {
+          throw std::out_of_range(
+                "The borrowed reference of entity ["
+                + std::to_string(_identity.id) + "] has expired");
+        }
+
         return _identity.ref;
       }
+
+      /////////////////////////////////////////////////
+      bool Implementation::IsCurrentGeneration(const Identity &) const
+      {
+        return true;
+      }
     }
 
     /////////////////////////////////////////////////
@@ -57,10 +87,25 @@ namespace ignition
       return id;
     }
 
+    /////////////////////////////////////////////////
+    bool Identity::Borrowed() const
+    {
+      return ref && ref.use_count() == 0;
+    }
+
+    /////////////////////////////////////////////////
+    Identity Identity::Borrow() const
+    {
+      return Identity(
+            id, std::shared_ptr<void>(std::shared_ptr<void>(), ref.get()),
+            generation);
+    }
+
     /////////////////////////////////////////////////
     Identity::Identity()
       : id(INVALID_ENTITY_ID),
-        ref(nullptr)
+        ref(nullptr),
+        generation(0)
     {
       // Do nothing
     }
@@ -68,9 +113,11 @@ namespace ignition
     /////////////////////////////////////////////////
     Identity::Identity(
         std::size_t _id,
-        const std::shared_ptr<void> &_ref)
+        const std::shared_ptr<void> &_ref,
+        std::size_t _generation)
       : id(_id),
-        ref(_ref)
+        ref(_ref),
+        generation(_generation)
     {
       // Do nothing
     }
@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+
 #define IGNITION_UNITTEST_EXPECTDATA_ACCESS
 
 #include "utils/TestDataTypes.hh"
@@ -280,6 +282,16 @@ TEST(SpecifyData, QueryCounting)
   EXPECT_EQ(4u, data.EntryCount());
   EXPECT_EQ(2u, data.UnqueriedEntryCount());
 
+  // Test InsertOrAssign on an existing expected type from its own value
+  const std::string longString = "a string which is too long to be inline";
+  data.Get<StringData>().myString = longString;
+  usedExpectedDataAccess = false;
+  EXPECT_EQ(longString, data.InsertOrAssign<StringData>(
+              data.Get<StringData>().myString).data.myString);
+  EXPECT_TRUE(usedExpectedDataAccess);
+  EXPECT_EQ(4u, data.EntryCount());
+  EXPECT_EQ(2u, data.UnqueriedEntryCount());
+
   // Test InsertOrAssign on a non-existent unexpected type
   usedExpectedDataAccess = false;
   EXPECT_NEAR(2.66, data.InsertOrAssign<DoubleData>(2.66).data.myDouble, 1e-8);
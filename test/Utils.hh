@@ -18,6 +18,9 @@
 #ifndef IGNITION_PHYSICS_TEST_UTILS_HH_
 #define IGNITION_PHYSICS_TEST_UTILS_HH_
 
+#include <atomic>
+#include <cstddef>
+
 #include <ignition/math/Helpers.hh>
 #include <ignition/math/Rand.hh>
 #include <ignition/physics/FrameData.hh>
@@ -217,6 +220,24 @@ namespace ignition
 
         return result;
       }
+
+      /////////////////////////////////////////////////
+      /// \brief Counter of the heap allocations of a test. A test that counts
+      /// allocations replaces the global operator new with one that
+      /// increments this. The count is atomic, so that worlds can be stepped
+      /// on several threads.
+      inline std::atomic<std::size_t> &AllocationCounter()
+      {
+        static std::atomic<std::size_t> count{0};
+        return count;
+      }
+
+      /////////////////////////////////////////////////
+      /// \brief Number of heap allocations counted so far
+      inline std::size_t AllocationCount()
+      {
+        return AllocationCounter().load();
+      }
     }
   }
 }
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <ignition/physics/BatchJointState.hh>
+#include <ignition/physics/ConstructEmpty.hh>
+#include <ignition/physics/GetEntities.hh>
+#include <ignition/physics/Joint.hh>
+#include <ignition/physics/RequestEngine.hh>
+#include <ignition/physics/RevoluteJoint.hh>
+
+#include <test/benchmark/Utils.hh>
+
+using BenchmarkFeatureList = ignition::physics::FeatureList<
+  ignition::physics::AttachRevoluteJointFeature,
+  ignition::physics::ConstructEmptyWorldFeature,
+  ignition::physics::ConstructEmptyModelFeature,
+  ignition::physics::ConstructEmptyLinkFeature,
+  ignition::physics::GetBasicJointProperties,
+  ignition::physics::GetBasicJointState,
+  ignition::physics::GetBatchJointState,
+  ignition::physics::GetEntities
+>;
+
+using BenchmarkEnginePtr =
+    ignition::physics::Engine3dPtr<BenchmarkFeatureList>;
+using BenchmarkWorldPtr =
+    ignition::physics::World3dPtr<BenchmarkFeatureList>;
+using BenchmarkJointPtr =
+    ignition::physics::Joint3dPtr<BenchmarkFeatureList>;
+
+// Number of revolute joints in each chain model
+const std::size_t gNumJointsPerModel = 20;
+
+/////////////////////////////////////////////////
+BenchmarkEnginePtr LoadEngine()
+{
+  return ignition::physics::test::LoadEngine<BenchmarkFeatureList>();
+}
+
+/////////////////////////////////////////////////
+/// \brief Construct a world with _numModels models, each of which is a chain
+/// of gNumJointsPerModel links connected by revolute joints.
+BenchmarkWorldPtr ConstructChainWorld(
+    const BenchmarkEnginePtr &_engine, const std::size_t _numModels)
+{
+  auto world = _engine->ConstructEmptyWorld("chains");
+  for (std::size_t m = 0; m < _numModels; ++m)
+  {
+    auto model = world->ConstructEmptyModel("chain_" + std::to_string(m));
+
+    ignition::physics::Link3dPtr<BenchmarkFeatureList> parent;
+    for (std::size_t j = 0; j < gNumJointsPerModel; ++j)
+    {
+      auto link = model->ConstructEmptyLink("link_" + std::to_string(j));
+      link->AttachRevoluteJoint(parent, "joint_" + std::to_string(j));
+      parent = link;
+    }
+  }
+
+  return world;
+}
+
+/////////////////////////////////////////////////
+// NOLINTNEXTLINE
+void BM_PerJointState(benchmark::State &_st)
+{
+  auto engine = LoadEngine();
+  auto world = ConstructChainWorld(engine, _st.range(0));
+
+  std::vector<BenchmarkJointPtr> joints;
+  for (std::size_t m = 0; m < world->GetModelCount(); ++m)
+  {
+    auto model = world->GetModel(m);
+    for (std::size_t j = 0; j < model->GetJointCount(); ++j)
+      joints.push_back(model->GetJoint(j));
+  }
+
+  double sum = 0.0;
+  for (auto _ : _st)
+  {
+    for (const auto &joint : joints)
+    {
+      for (std::size_t dof = 0; dof < joint->GetDegreesOfFreedom(); ++dof)
+      {
+        sum += joint->GetPosition(dof);
+        sum += joint->GetVelocity(dof);
+        sum += joint->GetForce(dof);
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+/////////////////////////////////////////////////
+// NOLINTNEXTLINE
+void BM_ModelBatchJointState(benchmark::State &_st)
+{
+  auto engine = LoadEngine();
+  auto world = ConstructChainWorld(engine, _st.range(0));
+
+  std::vector<ignition::physics::Model3dPtr<BenchmarkFeatureList>> models;
+  for (std::size_t m = 0; m < world->GetModelCount(); ++m)
+    models.push_back(world->GetModel(m));
+
+  std::vector<double> positions;
+  std::vector<double> velocities;
+  std::vector<double> forces;
+
+  for (auto _ : _st)
+  {
+    for (const auto &model : models)
+    {
+      model->GetJointState(&positions, &velocities, nullptr, &forces);
+      benchmark::DoNotOptimize(positions.data());
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+// NOLINTNEXTLINE
+void BM_WorldBatchJointState(benchmark::State &_st)
+{
+  auto engine = LoadEngine();
+  auto world = ConstructChainWorld(engine, _st.range(0));
+
+  std::vector<double> positions;
+  std::vector<double> velocities;
+  std::vector<double> forces;
+
+  for (auto _ : _st)
+  {
+    world->GetJointState(&positions, &velocities, nullptr, &forces);
+    benchmark::DoNotOptimize(positions.data());
+  }
+}
+
+// NOLINTNEXTLINE
+BENCHMARK(BM_PerJointState)->Arg(1)->Arg(10)->Arg(30);
+// NOLINTNEXTLINE
+BENCHMARK(BM_ModelBatchJointState)->Arg(1)->Arg(10)->Arg(30);
+// NOLINTNEXTLINE
+BENCHMARK(BM_WorldBatchJointState)->Arg(1)->Arg(10)->Arg(30);
+
+// OSX needs the semicolon, Ubuntu complains that there's an extra ';'
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+BENCHMARK_MAIN();
+#pragma GCC diagnostic pop
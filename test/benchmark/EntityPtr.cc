@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include <ignition/physics/FeatureList.hh>
+#include <ignition/physics/FeaturePolicy.hh>
+
+using MockList = ignition::physics::FeatureList<ignition::physics::Feature>;
+using MockLinkPtr = ignition::physics::Link3dPtr<MockList>;
+using MockPimpl =
+    ignition::physics::Entity<ignition::physics::FeaturePolicy3d, MockList>
+        ::Pimpl;
+
+/////////////////////////////////////////////////
+/// \brief Stands in for a physics engine plugin so that we can generate
+/// identities without loading one.
+class MockImplementation : public ignition::physics::detail::Implementation
+{
+  public: ignition::physics::Identity Generate(std::size_t _id) const
+  {
+    return this->GenerateIdentity(_id, this->object);
+  }
+
+  public: ignition::physics::Identity GenerateBorrowed(std::size_t _id) const
+  {
+    return this->GenerateBorrowedIdentity(_id, this->object.get());
+  }
+
+  public: std::shared_ptr<MockPimpl> pimpl = std::make_shared<MockPimpl>();
+
+  public: std::shared_ptr<void> object = std::make_shared<int>(0);
+};
+
+/////////////////////////////////////////////////
+/// \brief The entities of every benchmark are shared by all of its threads,
+/// like the entities of a physics engine that several threads read from.
+const MockImplementation &Implementation()
+{
+  static const MockImplementation implementation;
+  return implementation;
+}
+
+/////////////////////////////////////////////////
+const MockLinkPtr &OwningLink()
+{
+  static const MockLinkPtr link(
+        Implementation().pimpl, Implementation().Generate(1));
+  return link;
+}
+
+/////////////////////////////////////////////////
+const MockLinkPtr &BorrowedLink()
+{
+  static const MockLinkPtr link = OwningLink().Borrow();
+  return link;
+}
+
+/////////////////////////////////////////////////
+// Generate the identities of a list of entities, which is what an engine does
+// whenever it returns entities, e.g. for the contacts of a step.
+// NOLINTNEXTLINE
+void BM_GenerateIdentity(benchmark::State &_st)
+{
+  const MockImplementation &implementation = Implementation();
+  for (auto _ : _st)
+  {
+    for (int i = 0; i < _st.range(0); ++i)
+      benchmark::DoNotOptimize(implementation.Generate(i));
+  }
+}
+
+/////////////////////////////////////////////////
+// NOLINTNEXTLINE
+void BM_GenerateBorrowedIdentity(benchmark::State &_st)
+{
+  const MockImplementation &implementation = Implementation();
+  for (auto _ : _st)
+  {
+    for (int i = 0; i < _st.range(0); ++i)
+      benchmark::DoNotOptimize(implementation.GenerateBorrowed(i));
+  }
+}
+
+/////////////////////////////////////////////////
+// Copy the same entity into a list, e.g. to hand it to a set of callbacks.
+// NOLINTNEXTLINE
+void CopyLink(benchmark::State &_st, const MockLinkPtr &_link)
+{
+  std::vector<MockLinkPtr> copies;
+  copies.reserve(static_cast<std::size_t>(_st.range(0)));
+  for (auto _ : _st)
+  {
+    for (int i = 0; i < _st.range(0); ++i)
+      copies.push_back(_link);
+
+    benchmark::DoNotOptimize(copies.data());
+    copies.clear();
+  }
+}
+
+/////////////////////////////////////////////////
+// NOLINTNEXTLINE
+void BM_CopyOwningEntityPtr(benchmark::State &_st)
+{
+  CopyLink(_st, OwningLink());
+}
+
+/////////////////////////////////////////////////
+// NOLINTNEXTLINE
+void BM_CopyBorrowedEntityPtr(benchmark::State &_st)
+{
+  CopyLink(_st, BorrowedLink());
+}
+
+// NOLINTNEXTLINE
+BENCHMARK(BM_GenerateIdentity)->Arg(1000)->ThreadRange(1, 8);
+// NOLINTNEXTLINE
+BENCHMARK(BM_GenerateBorrowedIdentity)->Arg(1000)->ThreadRange(1, 8);
+// NOLINTNEXTLINE
+BENCHMARK(BM_CopyOwningEntityPtr)->Arg(1000)->ThreadRange(1, 8);
+// NOLINTNEXTLINE
+BENCHMARK(BM_CopyBorrowedEntityPtr)->Arg(1000)->ThreadRange(1, 8);
+
+// OSX needs the semicolon, Ubuntu complains that there's an extra ';'
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+BENCHMARK_MAIN();
+#pragma GCC diagnostic pop
@@ -73,6 +73,13 @@ ignition::physics::CompositeData CreatePerformanceTestData()
       FloatData, VectorDoubleData, BoolData, CharData>();
 }
 
+// Small, trivially-copyable data types, like most of the inputs and outputs
+// of a simulation step
+ignition::physics::CompositeData CreateSmallTestData()
+{
+  return CreateSomeData<DoubleData, IntData, FloatData, BoolData, CharData>();
+}
+
 // NaiveCompositionBase and NaiveComposition are used to produce a reference
 // performance result that can help put the CompositeData performance in
 // perspective.
@@ -105,6 +112,76 @@ void BM_Expect(benchmark::State& _st)
   }
 }
 
+// Get a small data type which the CompositeData does not expect, so it has to
+// be looked up by its type
+template <class Q>
+// NOLINTNEXTLINE
+void BM_GetSmall(benchmark::State& _st)
+{
+  size_t numTests = _st.range(0);
+  Q expect;
+  expect.Copy(CreatePerformanceTestData());
+
+  for (auto _ : _st)
+  {
+    for (std::size_t i=0; i < numTests; ++i)
+    {
+      benchmark::DoNotOptimize(expect.template Get<DoubleData>());
+    }
+  }
+}
+
+// Fill an empty CompositeData, the way a new step output gets filled
+// NOLINTNEXTLINE
+void BM_InsertSmall(benchmark::State& _st)
+{
+  for (auto _ : _st)
+  {
+    ignition::physics::CompositeData data;
+    data.Insert<DoubleData>();
+    data.Insert<IntData>();
+    data.Insert<FloatData>();
+    data.Insert<BoolData>();
+    data.Insert<CharData>();
+    benchmark::DoNotOptimize(data.EntryCount());
+  }
+}
+
+// Copy into a CompositeData which already has entries for the same types
+// NOLINTNEXTLINE
+void BM_CopyInto(benchmark::State& _st)
+{
+  const ignition::physics::CompositeData small = CreateSmallTestData();
+  const ignition::physics::CompositeData mixed = CreatePerformanceTestData();
+  const ignition::physics::CompositeData &source =
+      _st.range(0) == 0 ? small : mixed;
+
+  ignition::physics::CompositeData target;
+  target.Copy(source);
+
+  for (auto _ : _st)
+  {
+    target.Copy(source);
+    benchmark::DoNotOptimize(target.EntryCount());
+  }
+}
+
+// Copy into a new CompositeData
+// NOLINTNEXTLINE
+void BM_CopyConstruct(benchmark::State& _st)
+{
+  const ignition::physics::CompositeData small = CreateSmallTestData();
+  const ignition::physics::CompositeData mixed = CreatePerformanceTestData();
+  const ignition::physics::CompositeData &source =
+      _st.range(0) == 0 ? small : mixed;
+
+  for (auto _ : _st)
+  {
+    ignition::physics::CompositeData target(source);
+    benchmark::DoNotOptimize(target.EntryCount());
+  }
+}
+
 // NOLINTNEXTLINE
 void BM_Naive(benchmark::State& _st)
 {
@@ -149,6 +226,19 @@ BENCHMARK_TEMPLATE(BM_Expect, Expect20Types_Leading)->Arg(gNumTests);
 BENCHMARK_TEMPLATE(BM_Expect, Expect20Types_Trailing)->Arg(gNumTests);
 // NOLINTNEXTLINE
 BENCHMARK_TEMPLATE(BM_Expect, ignition::physics::CompositeData)->Arg(gNumTests);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(BM_GetSmall, ignition::physics::CompositeData)
+    ->Arg(gNumTests);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(BM_GetSmall, Expect3Types_Leading)->Arg(gNumTests);
+// NOLINTNEXTLINE
+BENCHMARK(BM_InsertSmall);
+// Argument 0 copies only small data types, argument 1 also copies a string
+// and a vector.
+// NOLINTNEXTLINE
+BENCHMARK(BM_CopyInto)->Arg(0)->Arg(1);
+// NOLINTNEXTLINE
+BENCHMARK(BM_CopyConstruct)->Arg(0)->Arg(1);
 
 // OSX needs the semicolon, Ubuntu complains that there's an extra ';'
 #pragma GCC diagnostic push
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <ignition/physics/ConstructEmpty.hh>
+#include <ignition/physics/FrameSemantics.hh>
+#include <ignition/physics/GetEntities.hh>
+#include <ignition/physics/Joint.hh>
+#include <ignition/physics/RequestEngine.hh>
+#include <ignition/physics/RevoluteJoint.hh>
+
+#include <test/benchmark/Utils.hh>
+
+using BenchmarkFeatureList = ignition::physics::FeatureList<
+  ignition::physics::AttachRevoluteJointFeature,
+  ignition::physics::ConstructEmptyWorldFeature,
+  ignition::physics::ConstructEmptyModelFeature,
+  ignition::physics::ConstructEmptyLinkFeature,
+  ignition::physics::GetEntities,
+  ignition::physics::LinkFrameSemantics,
+  ignition::physics::SetBasicJointState
+>;
+
+using BenchmarkEnginePtr =
+    ignition::physics::Engine3dPtr<BenchmarkFeatureList>;
+using BenchmarkJointPtr =
+    ignition::physics::Joint3dPtr<BenchmarkFeatureList>;
+using BenchmarkLinkPtr =
+    ignition::physics::Link3dPtr<BenchmarkFeatureList>;
+
+/////////////////////////////////////////////////
+BenchmarkEnginePtr LoadEngine()
+{
+  return ignition::physics::test::LoadEngine<BenchmarkFeatureList>();
+}
+
+/////////////////////////////////////////////////
+/// \brief A chain of links connected by revolute joints. The frames of the
+/// links are queried after the root joint moves, which makes DART recompute
+/// the kinematics of the whole chain.
+struct Chain
+{
+  BenchmarkJointPtr rootJoint;
+  std::vector<BenchmarkLinkPtr> links;
+  std::vector<ignition::physics::FrameID> frames;
+};
+
+/////////////////////////////////////////////////
+Chain ConstructChain(
+    const BenchmarkEnginePtr &_engine, const std::size_t _numLinks)
+{
+  auto world = _engine->ConstructEmptyWorld("chain");
+  auto model = world->ConstructEmptyModel("chain");
+
+  Chain chain;
+  BenchmarkLinkPtr parent;
+  for (std::size_t i = 0; i < _numLinks; ++i)
+  {
+    auto link = model->ConstructEmptyLink("link_" + std::to_string(i));
+    auto joint =
+        link->AttachRevoluteJoint(parent, "joint_" + std::to_string(i));
+    if (!chain.rootJoint)
+      chain.rootJoint = joint;
+
+    chain.links.push_back(link);
+    chain.frames.push_back(link->GetFrameID());
+    parent = link;
+  }
+
+  return chain;
+}
+
+/////////////////////////////////////////////////
+/// \brief Move the root joint so that the kinematics of every link in the
+/// chain become outdated.
+void MoveChain(const Chain &_chain, const std::size_t _iteration)
+{
+  _chain.rootJoint->SetPosition(0, 1e-3 * static_cast<double>(_iteration));
+  _chain.rootJoint->SetVelocity(0, 1.0);
+}
+
+/////////////////////////////////////////////////
+// Baseline: read the full FrameData of every link, which includes the
+// velocities and accelerations, and only use its position.
+// NOLINTNEXTLINE
+void BM_FullFrameData(benchmark::State &_st)
+{
+  auto engine = LoadEngine();
+  const Chain chain = ConstructChain(engine, _st.range(0));
+
+  std::size_t iteration = 0;
+  for (auto _ : _st)
+  {
+    MoveChain(chain, iteration++);
+    for (const auto &link : chain.links)
+    {
+      benchmark::DoNotOptimize(
+          link->FrameDataRelativeToWorld().pose.translation());
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+// Resolve a point in each link, which only asks the engine for the poses.
+// NOLINTNEXTLINE
+void BM_ResolvePoints(benchmark::State &_st)
+{
+  auto engine = LoadEngine();
+  const Chain chain = ConstructChain(engine, _st.range(0));
+
+  std::size_t iteration = 0;
+  for (auto _ : _st)
+  {
+    MoveChain(chain, iteration++);
+    for (const auto &frame : chain.frames)
+    {
+      benchmark::DoNotOptimize(engine->Resolve(
+          ignition::physics::RelativePosition3d(
+            frame, Eigen::Vector3d::UnitX())));
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+// Same as BM_ResolvePoints, using the batch version of Resolve.
+// NOLINTNEXTLINE
+void BM_ResolvePointsBatch(benchmark::State &_st)
+{
+  auto engine = LoadEngine();
+  const Chain chain = ConstructChain(engine, _st.range(0));
+
+  std::vector<ignition::physics::RelativePosition3d> points;
+  for (const auto &frame : chain.frames)
+    points.emplace_back(frame, Eigen::Vector3d::UnitX());
+
+  std::vector<Eigen::Vector3d> resolved;
+  std::size_t iteration = 0;
+  for (auto _ : _st)
+  {
+    MoveChain(chain, iteration++);
+    engine->Resolve(points, resolved);
+    benchmark::DoNotOptimize(resolved.data());
+  }
+}
+
+// NOLINTNEXTLINE
+BENCHMARK(BM_FullFrameData)->Arg(10)->Arg(50)->Arg(200);
+// NOLINTNEXTLINE
+BENCHMARK(BM_ResolvePoints)->Arg(10)->Arg(50)->Arg(200);
+// NOLINTNEXTLINE
+BENCHMARK(BM_ResolvePointsBatch)->Arg(10)->Arg(50)->Arg(200);
+
+// OSX needs the semicolon, Ubuntu complains that there's an extra ';'
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+BENCHMARK_MAIN();
+#pragma GCC diagnostic pop
@@ -0,0 +1,274 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <sstream>
+#include <string>
+
+#include <ignition/physics/RequestEngine.hh>
+#include <ignition/physics/sdf/ConstructModel.hh>
+#include <ignition/physics/sdf/ConstructModelTemplate.hh>
+#include <ignition/physics/sdf/ConstructWorld.hh>
+
+#include <sdf/Model.hh>
+#include <sdf/Root.hh>
+#include <sdf/World.hh>
+
+#include <test/benchmark/Utils.hh>
+
+using BenchmarkFeatureList = ignition::physics::FeatureList<
+  ignition::physics::sdf::ConstructSdfModel,
+  ignition::physics::sdf::ConstructSdfModelTemplate,
+  ignition::physics::sdf::ConstructSdfWorld,
+  ignition::physics::sdf::ParallelConstructSdfWorld
+>;
+
+using BenchmarkEnginePtr =
+    ignition::physics::Engine3dPtr<BenchmarkFeatureList>;
+
+/////////////////////////////////////////////////
+BenchmarkEnginePtr LoadEngine()
+{
+  return ignition::physics::test::LoadEngine<BenchmarkFeatureList>();
+}
+
+/////////////////////////////////////////////////
+/// \brief SDF of a world with _numModels models whose only collision is the
+/// chassis mesh. If _distinctScales is true, every model scales the mesh
+/// differently, so no two collisions can share a shape.
+std::string MeshWorld(const std::size_t _numModels, const bool _distinctScales)
+{
+  std::stringstream sdf;
+  sdf << "<sdf version='1.6'><world name='meshes'>";
+  for (std::size_t i = 0; i < _numModels; ++i)
+  {
+    const double scale =
+        _distinctScales ? 1.0 + static_cast<double>(i) * 1e-3 : 1.0;
+
+    sdf << "<model name='chassis_" << i << "'>"
+        << "  <pose>" << static_cast<double>(i) << " 0 0 0 0 0</pose>"
+        << "  <link name='link'>"
+        << "    <collision name='collision'>"
+        << "      <geometry><mesh>"
+        << "        <uri>file://" IGNITION_PHYSICS_RESOURCE_DIR "/chassis.dae"
+        << "</uri>"
+        << "        <scale>" << scale << " " << scale << " " << scale
+        << "</scale>"
+        << "      </mesh></geometry>"
+        << "    </collision>"
+        << "  </link>"
+        << "</model>";
+  }
+  sdf << "</world></sdf>";
+
+  return sdf.str();
+}
+
+/////////////////////////////////////////////////
+/// \brief SDF of a warehouse with _numModels shelving robots, each made of a
+/// chassis mesh and a chain of four revolute links with box collisions.
+std::string WarehouseWorld(const std::size_t _numModels)
+{
+  std::stringstream sdf;
+  sdf << "<sdf version='1.6'><world name='warehouse'>";
+  for (std::size_t i = 0; i < _numModels; ++i)
+  {
+    sdf << "<model name='robot_" << i << "'>"
+        << "  <pose>" << static_cast<double>(i % 50) << " "
+        << static_cast<double>(i / 50) << " 0 0 0 0</pose>"
+        << "  <link name='base'>"
+        << "    <collision name='collision'>"
+        << "      <geometry><mesh>"
+        << "        <uri>file://" IGNITION_PHYSICS_RESOURCE_DIR "/chassis.dae"
+        << "</uri>"
+        << "      </mesh></geometry>"
+        << "    </collision>"
+        << "  </link>";
+
+    for (std::size_t j = 0; j < 4; ++j)
+    {
+      const std::string parent =
+          j == 0 ? "base" : "segment_" + std::to_string(j - 1);
+
+      sdf << "  <link name='segment_" << j << "'>"
+          << "    <pose>0 0 " << 0.2 * static_cast<double>(j + 1)
+          << " 0 0 0</pose>"
+          << "    <collision name='collision'>"
+          << "      <geometry><box><size>0.1 0.1 0.2</size></box></geometry>"
+          << "    </collision>"
+          << "  </link>"
+          << "  <joint name='joint_" << j << "' type='revolute'>"
+          << "    <parent>" << parent << "</parent>"
+          << "    <child>segment_" << j << "</child>"
+          << "    <axis><xyz>1 0 0</xyz></axis>"
+          << "  </joint>";
+    }
+
+    sdf << "</model>";
+  }
+  sdf << "</world></sdf>";
+
+  return sdf.str();
+}
+
+/////////////////////////////////////////////////
+/// \brief Construct the world of _sdf in a new engine once per iteration.
+/// The engine is new every time, so its mesh cache starts empty.
+void ConstructWorld(benchmark::State &_st, const std::string &_sdf,
+                    const std::size_t _numThreads = 1)
+{
+  sdf::Root root;
+  if (!root.LoadSdfString(_sdf).empty())
+  {
+    _st.SkipWithError("Failed to parse the world");
+    return;
+  }
+
+  for (auto _ : _st)
+  {
+    _st.PauseTiming();
+    auto engine = LoadEngine();
+    engine->SetConstructWorldThreadCount(_numThreads);
+    _st.ResumeTiming();
+
+    benchmark::DoNotOptimize(engine->ConstructWorld(*root.WorldByIndex(0)));
+
+    _st.PauseTiming();
+    engine = nullptr;
+    _st.ResumeTiming();
+  }
+
+  _st.counters["models/s"] = benchmark::Counter(
+      static_cast<double>(_st.iterations() * _st.range(0)),
+      benchmark::Counter::kIsRate);
+}
+
+/////////////////////////////////////////////////
+/// \brief Spawn range(0) warehouse robots into an empty world once per
+/// iteration, either by constructing each of them from SDF or by copying a
+/// template that is built in the same iteration.
+void SpawnRobots(benchmark::State &_st, const bool _useTemplate)
+{
+  sdf::Root emptyRoot;
+  sdf::Root robotRoot;
+  if (!emptyRoot.LoadSdfString(WarehouseWorld(0)).empty()
+      || !robotRoot.LoadSdfString(WarehouseWorld(1)).empty())
+  {
+    _st.SkipWithError("Failed to parse the world");
+    return;
+  }
+  const sdf::Model &robot = *robotRoot.WorldByIndex(0)->ModelByIndex(0);
+  const std::size_t numModels = static_cast<std::size_t>(_st.range(0));
+
+  for (auto _ : _st)
+  {
+    _st.PauseTiming();
+    auto engine = LoadEngine();
+    auto world = engine->ConstructWorld(*emptyRoot.WorldByIndex(0));
+    _st.ResumeTiming();
+
+    if (_useTemplate)
+    {
+      const std::size_t templateID = engine->ConstructModelTemplate(robot);
+      for (std::size_t i = 0; i < numModels; ++i)
+      {
+        const Eigen::Isometry3d pose(Eigen::Translation3d(
+            static_cast<double>(i % 50), static_cast<double>(i / 50), 0.0));
+        benchmark::DoNotOptimize(world->ConstructModelFromTemplate(
+            templateID, "robot_" + std::to_string(i), pose));
+      }
+    }
+    else
+    {
+      for (std::size_t i = 0; i < numModels; ++i)
+        benchmark::DoNotOptimize(world->ConstructModel(robot));
+    }
+
+    _st.PauseTiming();
+    world = nullptr;
+    engine = nullptr;
+    _st.ResumeTiming();
+  }
+
+  _st.counters["models/s"] = benchmark::Counter(
+      static_cast<double>(_st.iterations() * _st.range(0)),
+      benchmark::Counter::kIsRate);
+}
+
+/////////////////////////////////////////////////
+// Every model uses the same mesh with the same scale, so it is converted once.
+// NOLINTNEXTLINE
+void BM_LoadSharedMeshes(benchmark::State &_st)
+{
+  ConstructWorld(_st, MeshWorld(_st.range(0), false));
+}
+
+/////////////////////////////////////////////////
+// Every model uses a different scale, so the mesh is converted for each one.
+// NOLINTNEXTLINE
+void BM_LoadDistinctMeshes(benchmark::State &_st)
+{
+  ConstructWorld(_st, MeshWorld(_st.range(0), true));
+}
+
+/////////////////////////////////////////////////
+// Construct the warehouse with range(0) robots on range(1) threads.
+// NOLINTNEXTLINE
+void BM_LoadWarehouse(benchmark::State &_st)
+{
+  ConstructWorld(_st, WarehouseWorld(_st.range(0)), _st.range(1));
+}
+
+/////////////////////////////////////////////////
+// Spawn range(0) robots by constructing each of them from SDF.
+// NOLINTNEXTLINE
+void BM_SpawnFromSdf(benchmark::State &_st)
+{
+  SpawnRobots(_st, false);
+}
+
+/////////////////////////////////////////////////
+// Spawn range(0) robots by copying a template of the robot.
+// NOLINTNEXTLINE
+void BM_SpawnFromTemplate(benchmark::State &_st)
+{
+  SpawnRobots(_st, true);
+}
+
+// NOLINTNEXTLINE
+BENCHMARK(BM_LoadSharedMeshes)
+    ->Arg(1)->Arg(100)->Arg(500)->Unit(benchmark::kMillisecond);
+// NOLINTNEXTLINE
+BENCHMARK(BM_LoadDistinctMeshes)
+    ->Arg(1)->Arg(100)->Arg(500)->Unit(benchmark::kMillisecond);
+// NOLINTNEXTLINE
+BENCHMARK(BM_LoadWarehouse)
+    ->Args({2000, 1})->Args({2000, 2})->Args({2000, 4})->Args({2000, 8})
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
+// NOLINTNEXTLINE
+BENCHMARK(BM_SpawnFromSdf)
+    ->Arg(1)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+// NOLINTNEXTLINE
+BENCHMARK(BM_SpawnFromTemplate)
+    ->Arg(1)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+// OSX needs the semicolon, Ubuntu complains that there's an extra ';'
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+BENCHMARK_MAIN();
+#pragma GCC diagnostic pop
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <ignition/physics/ConstructEmpty.hh>
+#include <ignition/physics/GetEntities.hh>
+#include <ignition/physics/RemoveEntities.hh>
+#include <ignition/physics/RequestEngine.hh>
+
+#include <test/benchmark/Utils.hh>
+
+using BenchmarkFeatureList = ignition::physics::FeatureList<
+  ignition::physics::ConstructEmptyWorldFeature,
+  ignition::physics::ConstructEmptyModelFeature,
+  ignition::physics::GetEntities,
+  ignition::physics::RemoveEntities
+>;
+
+using BenchmarkEnginePtr =
+    ignition::physics::Engine3dPtr<BenchmarkFeatureList>;
+using BenchmarkWorldPtr =
+    ignition::physics::World3dPtr<BenchmarkFeatureList>;
+using BenchmarkModelPtr =
+    ignition::physics::Model3dPtr<BenchmarkFeatureList>;
+
+/////////////////////////////////////////////////
+BenchmarkEnginePtr LoadEngine()
+{
+  return ignition::physics::test::LoadEngine<BenchmarkFeatureList>();
+}
+
+/////////////////////////////////////////////////
+/// \brief Fill a new world with _numModels empty models
+std::vector<BenchmarkModelPtr> PopulateWorld(
+    const BenchmarkEnginePtr &_engine, BenchmarkWorldPtr &_world,
+    const std::size_t _numModels)
+{
+  _world = _engine->ConstructEmptyWorld("world");
+
+  std::vector<BenchmarkModelPtr> models;
+  models.reserve(_numModels);
+  for (std::size_t i = 0; i < _numModels; ++i)
+    models.push_back(_world->ConstructEmptyModel("model_" + std::to_string(i)));
+
+  return models;
+}
+
+/////////////////////////////////////////////////
+// Remove every model one at a time, always taking the first one, which is the
+// worst case for keeping the indices of the remaining models up to date.
+// NOLINTNEXTLINE
+void BM_RemoveModelsOneByOne(benchmark::State &_st)
+{
+  for (auto _ : _st)
+  {
+    _st.PauseTiming();
+    auto engine = LoadEngine();
+    BenchmarkWorldPtr world;
+    auto models = PopulateWorld(engine, world, _st.range(0));
+    _st.ResumeTiming();
+
+    for (const auto &model : models)
+      model->Remove();
+
+    benchmark::DoNotOptimize(world->GetModelCount());
+
+    _st.PauseTiming();
+    models.clear();
+    world = nullptr;
+    engine = nullptr;
+    _st.ResumeTiming();
+  }
+}
+
+/////////////////////////////////////////////////
+// NOLINTNEXTLINE
+void BM_RemoveModelsBatch(benchmark::State &_st)
+{
+  for (auto _ : _st)
+  {
+    _st.PauseTiming();
+    auto engine = LoadEngine();
+    BenchmarkWorldPtr world;
+    auto models = PopulateWorld(engine, world, _st.range(0));
+    _st.ResumeTiming();
+
+    benchmark::DoNotOptimize(world->RemoveModels(models));
+
+    _st.PauseTiming();
+    models.clear();
+    world = nullptr;
+    engine = nullptr;
+    _st.ResumeTiming();
+  }
+}
+
+/////////////////////////////////////////////////
+// Remove and re-add a single model in a populated world, as a spawner does.
+// NOLINTNEXTLINE
+void BM_RespawnModel(benchmark::State &_st)
+{
+  auto engine = LoadEngine();
+  BenchmarkWorldPtr world;
+  auto models = PopulateWorld(engine, world, _st.range(0));
+
+  std::size_t count = 0;
+  for (auto _ : _st)
+  {
+    auto &model = models[count % models.size()];
+    model->Remove();
+    model = world->ConstructEmptyModel("respawn_" + std::to_string(count++));
+  }
+}
+
+// NOLINTNEXTLINE
+BENCHMARK(BM_RemoveModelsOneByOne)
+    ->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+// NOLINTNEXTLINE
+BENCHMARK(BM_RemoveModelsBatch)
+    ->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+// NOLINTNEXTLINE
+BENCHMARK(BM_RespawnModel)->Arg(100)->Arg(1000)->Arg(10000);
+
+// OSX needs the semicolon, Ubuntu complains that there's an extra ';'
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+BENCHMARK_MAIN();
+#pragma GCC diagnostic pop
@@ -0,0 +1,350 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ignition/common/MeshManager.hh>
+
+#include <ignition/physics/ConstructEmpty.hh>
+#include <ignition/physics/ForwardStep.hh>
+#include <ignition/physics/FreeGroup.hh>
+#include <ignition/physics/GetContacts.hh>
+#include <ignition/physics/GetEntities.hh>
+#include <ignition/physics/RequestEngine.hh>
+#include <ignition/physics/mesh/MeshShape.hh>
+#include <ignition/physics/sdf/ConstructWorld.hh>
+
+#include <sdf/Root.hh>
+#include <sdf/World.hh>
+
+#include <test/Utils.hh>
+#include <test/benchmark/Utils.hh>
+
+using BenchmarkFeatureList = ignition::physics::FeatureList<
+  ignition::physics::ConstructEmptyModelFeature,
+  ignition::physics::ConstructEmptyLinkFeature,
+  ignition::physics::FindFreeGroupFeature,
+  ignition::physics::ForwardStep,
+  ignition::physics::GetContactRecordsFromLastStepFeature,
+  ignition::physics::GetEntities,
+  ignition::physics::SetFreeGroupWorldPose,
+  ignition::physics::mesh::AttachMeshShapeFeature,
+  ignition::physics::sdf::ConstructSdfWorld
+>;
+
+using BenchmarkEnginePtr =
+    ignition::physics::Engine3dPtr<BenchmarkFeatureList>;
+using BenchmarkWorldPtr =
+    ignition::physics::World3dPtr<BenchmarkFeatureList>;
+using ContactRecord =
+    ignition::physics::GetContactRecordsFromLastStepFeature::ContactRecordT<
+      ignition::physics::FeaturePolicy3d>;
+
+using ignition::physics::test::AllocationCount;
+
+/////////////////////////////////////////////////
+// Count every allocation made by the process, including the ones made inside
+// the dartsim plugin, so that the benchmarks can report allocations per step.
+void *operator new(std::size_t _size)
+{
+  ++ignition::physics::test::AllocationCounter();
+  if (void *memory = std::malloc(_size == 0 ? 1 : _size))
+    return memory;
+
+  throw std::bad_alloc();
+}
+
+void operator delete(void *_memory) noexcept
+{
+  std::free(_memory);
+}
+
+void operator delete(void *_memory, std::size_t) noexcept
+{
+  std::free(_memory);
+}
+
+/////////////////////////////////////////////////
+BenchmarkEnginePtr LoadEngine()
+{
+  return ignition::physics::test::LoadEngine<BenchmarkFeatureList>();
+}
+
+/////////////////////////////////////////////////
+/// \brief Construct a world from an SDF string
+BenchmarkWorldPtr ConstructWorldFromString(
+    const BenchmarkEnginePtr &_engine, const std::string &_sdf)
+{
+  sdf::Root root;
+  const sdf::Errors errors = root.LoadSdfString(_sdf);
+  if (!errors.empty())
+    return nullptr;
+
+  return _engine->ConstructWorld(*root.WorldByIndex(0));
+}
+
+/////////////////////////////////////////////////
+/// \brief SDF of a static ground box whose top face is at z = 0
+std::string GroundModel()
+{
+  return
+    "<model name='ground'>"
+    "  <static>true</static>"
+    "  <pose>0 0 -0.5 0 0 0</pose>"
+    "  <link name='link'>"
+    "    <collision name='collision'>"
+    "      <geometry><box><size>100 100 1</size></box></geometry>"
+    "    </collision>"
+    "  </link>"
+    "</model>";
+}
+
+/////////////////////////////////////////////////
+/// \brief SDF of a world with _numBoxes boxes that are dropped on the ground
+/// in a grid, a few layers high, so that they hit the ground and each other.
+std::string FallingBoxesWorld(const std::size_t _numBoxes)
+{
+  const std::size_t perLayer = 10;
+  std::stringstream sdf;
+  sdf << "<sdf version='1.6'><world name='falling_boxes'>" << GroundModel();
+  for (std::size_t i = 0; i < _numBoxes; ++i)
+  {
+    const double x = static_cast<double>(i % perLayer) * 0.6;
+    const double y = static_cast<double>((i / perLayer) % perLayer) * 0.6;
+    const double z = 0.5 + static_cast<double>(i / (perLayer*perLayer)) * 0.6;
+    sdf << "<model name='box_" << i << "'>"
+        << "  <pose>" << x << " " << y << " " << z << " 0 0 0</pose>"
+        << "  <link name='link'>"
+        << "    <inertial><mass>1</mass></inertial>"
+        << "    <collision name='collision'>"
+        << "      <geometry><box><size>0.5 0.5 0.5</size></box></geometry>"
+        << "    </collision>"
+        << "  </link>"
+        << "</model>";
+  }
+  sdf << "</world></sdf>";
+
+  return sdf.str();
+}
+
+/////////////////////////////////////////////////
+/// \brief SDF of a world with a single pendulum made of _numLinks links
+/// connected by revolute joints, hanging from the world.
+std::string ChainWorld(const std::size_t _numLinks)
+{
+  std::stringstream sdf;
+  sdf << "<sdf version='1.6'><world name='chain'>"
+      << "<model name='chain'>"
+      << "  <pose>0 0 " << 0.2 * static_cast<double>(_numLinks) + 1.0
+      << " 1.2 0 0</pose>";
+  for (std::size_t i = 0; i < _numLinks; ++i)
+  {
+    sdf << "<link name='link_" << i << "'>"
+        << "  <pose>0 0 " << -0.2 * static_cast<double>(i) << " 0 0 0</pose>"
+        << "  <inertial><mass>0.1</mass></inertial>"
+        << "  <collision name='collision'>"
+        << "    <geometry><sphere><radius>0.05</radius></sphere></geometry>"
+        << "  </collision>"
+        << "</link>"
+        << "<joint name='joint_" << i << "' type='revolute'>"
+        << "  <parent>"
+        << (i == 0 ? "world" : "link_" + std::to_string(i-1))
+        << "</parent>"
+        << "  <child>link_" << i << "</child>"
+        << "  <axis><xyz>1 0 0</xyz></axis>"
+        << "</joint>";
+  }
+  sdf << "</model></world></sdf>";
+
+  return sdf.str();
+}
+
+/////////////////////////////////////////////////
+/// \brief Construct a world with a ground and _numMeshes copies of the
+/// chassis mesh stacked above it.
+BenchmarkWorldPtr ConstructMeshPileWorld(
+    const BenchmarkEnginePtr &_engine, const std::size_t _numMeshes)
+{
+  auto world = ConstructWorldFromString(_engine,
+      "<sdf version='1.6'><world name='mesh_pile'>" + GroundModel() +
+      "</world></sdf>");
+  if (!world)
+    return nullptr;
+
+  auto *mesh = ignition::common::MeshManager::Instance()->Load(
+      IGNITION_PHYSICS_RESOURCE_DIR "/chassis.dae");
+  if (!mesh)
+    return nullptr;
+
+  for (std::size_t i = 0; i < _numMeshes; ++i)
+  {
+    auto model = world->ConstructEmptyModel("mesh_" + std::to_string(i));
+    auto link = model->ConstructEmptyLink("link");
+    link->AttachMeshShape("chassis", *mesh);
+
+    const double x = static_cast<double>(i % 4) * 0.6;
+    const double y = static_cast<double>((i / 4) % 4) * 0.6;
+    const double z = 0.2 + static_cast<double>(i / 16) * 0.25;
+    ignition::physics::Pose3d pose = ignition::physics::Pose3d::Identity();
+    pose.translation() = Eigen::Vector3d(x, y, z);
+    model->FindFreeGroup()->SetWorldPose(pose);
+  }
+
+  return world;
+}
+
+/////////////////////////////////////////////////
+/// \brief Step _world once per benchmark iteration and report the step rate,
+/// the number of contacts and the number of allocations of each step.
+void StepWorld(benchmark::State &_st, const BenchmarkWorldPtr &_world)
+{
+  if (!_world)
+  {
+    _st.SkipWithError("Failed to construct the world");
+    return;
+  }
+
+  ignition::physics::ForwardStep::Output output;
+  ignition::physics::ForwardStep::State state;
+  ignition::physics::ForwardStep::Input input;
+  std::vector<ContactRecord> contacts;
+
+  std::size_t numContacts = 0;
+  std::size_t numAllocations = 0;
+  for (auto _ : _st)
+  {
+    const std::size_t allocationsBefore = AllocationCount();
+    _world->Step(output, state, input);
+    numAllocations += AllocationCount() - allocationsBefore;
+
+    _world->GetContactRecordsFromLastStep(contacts);
+    numContacts += contacts.size();
+  }
+
+  _st.counters["steps/s"] = benchmark::Counter(
+      static_cast<double>(_st.iterations()), benchmark::Counter::kIsRate);
+  _st.counters["contacts/step"] = benchmark::Counter(
+      static_cast<double>(numContacts), benchmark::Counter::kAvgIterations);
+  _st.counters["allocs/step"] = benchmark::Counter(
+      static_cast<double>(numAllocations), benchmark::Counter::kAvgIterations);
+}
+
+/////////////////////////////////////////////////
+// NOLINTNEXTLINE
+void BM_LoadWorldFile(benchmark::State &_st, const std::string &_file)
+{
+  sdf::Root root;
+  if (!root.Load(TEST_WORLD_DIR + _file).empty())
+  {
+    _st.SkipWithError("Failed to load the SDF file");
+    return;
+  }
+
+  for (auto _ : _st)
+  {
+    _st.PauseTiming();
+    auto engine = LoadEngine();
+    _st.ResumeTiming();
+
+    benchmark::DoNotOptimize(engine->ConstructWorld(*root.WorldByIndex(0)));
+
+    _st.PauseTiming();
+    engine = nullptr;
+    _st.ResumeTiming();
+  }
+}
+
+/////////////////////////////////////////////////
+// NOLINTNEXTLINE
+void BM_StepWorldFile(benchmark::State &_st, const std::string &_file)
+{
+  auto engine = LoadEngine();
+
+  sdf::Root root;
+  if (!root.Load(TEST_WORLD_DIR + _file).empty())
+  {
+    _st.SkipWithError("Failed to load the SDF file");
+    return;
+  }
+
+  StepWorld(_st, engine->ConstructWorld(*root.WorldByIndex(0)));
+}
+
+/////////////////////////////////////////////////
+// NOLINTNEXTLINE
+void BM_StepFallingBoxes(benchmark::State &_st)
+{
+  auto engine = LoadEngine();
+  StepWorld(_st, ConstructWorldFromString(
+      engine, FallingBoxesWorld(_st.range(0))));
+}
+
+/////////////////////////////////////////////////
+// NOLINTNEXTLINE
+void BM_StepChain(benchmark::State &_st)
+{
+  auto engine = LoadEngine();
+  StepWorld(_st, ConstructWorldFromString(engine, ChainWorld(_st.range(0))));
+}
+
+/////////////////////////////////////////////////
+// NOLINTNEXTLINE
+void BM_StepMeshPile(benchmark::State &_st)
+{
+  auto engine = LoadEngine();
+  StepWorld(_st, ConstructMeshPileWorld(engine, _st.range(0)));
+}
+
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_LoadWorldFile, falling, std::string("falling.world"))
+    ->Unit(benchmark::kMicrosecond);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_LoadWorldFile, test, std::string("test.world"))
+    ->Unit(benchmark::kMicrosecond);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_LoadWorldFile, contact, std::string("contact.sdf"))
+    ->Unit(benchmark::kMicrosecond);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_StepWorldFile, falling, std::string("falling.world"))
+    ->Unit(benchmark::kMicrosecond);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_StepWorldFile, test, std::string("test.world"))
+    ->Unit(benchmark::kMicrosecond);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_StepWorldFile, contact, std::string("contact.sdf"))
+    ->Unit(benchmark::kMicrosecond);
+// NOLINTNEXTLINE
+BENCHMARK(BM_StepFallingBoxes)
+    ->Arg(10)->Arg(100)->Arg(500)->Unit(benchmark::kMicrosecond);
+// NOLINTNEXTLINE
+BENCHMARK(BM_StepChain)
+    ->Arg(5)->Arg(20)->Arg(100)->Unit(benchmark::kMicrosecond);
+// NOLINTNEXTLINE
+BENCHMARK(BM_StepMeshPile)
+    ->Arg(4)->Arg(16)->Arg(64)->Unit(benchmark::kMicrosecond);
+
+// OSX needs the semicolon, Ubuntu complains that there's an extra ';'
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+BENCHMARK_MAIN();
+#pragma GCC diagnostic pop
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2020 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef IGNITION_PHYSICS_TEST_BENCHMARK_UTILS_HH_
+#define IGNITION_PHYSICS_TEST_BENCHMARK_UTILS_HH_
+
+#include <ignition/plugin/Loader.hh>
+#include <ignition/physics/RequestEngine.hh>
+
+namespace ignition
+{
+  namespace physics
+  {
+    namespace test
+    {
+      /////////////////////////////////////////////////
+      /// \brief Load the dartsim plugin and request an engine that provides
+      /// FeatureListT.
+      template <typename FeatureListT>
+      Engine3dPtr<FeatureListT> LoadEngine()
+      {
+        plugin::Loader loader;
+        loader.LoadLib(dartsim_plugin_LIB);
+
+        plugin::PluginPtr dartsim =
+            loader.Instantiate("ignition::physics::dartsim::Plugin");
+
+        return RequestEngine3d<FeatureListT>::From(dartsim);
+      }
+    }
+  }
+}
+
+#endif
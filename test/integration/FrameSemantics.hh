@@ -21,6 +21,7 @@
 #include <gtest/gtest.h>
 #include <cmath>
 #include <string>
+#include <vector>
 
 #include <ignition/plugin/Loader.hh>
 #include <ignition/plugin/PluginPtr.hh>
@@ -631,6 +632,40 @@ void TestRelativeQuantities(const double _tolerance, const std::string &_suffix)
         * O_T_A.RelativeToParent().pose.linear().transpose(),
            O_t3.RelativeToParent());
   EXPECT_TRUE(Equal(C_t3, fs->Resolve(O_t3, C), _tolerance));
+
+  // Resolving a batch of points with different parent frames must give the
+  // same results as resolving each point on its own
+  std::vector<RelativePosition> points;
+  for (std::size_t i = 0; i < 20; ++i)
+  {
+    const FrameID &parent = (i % 3 == 0) ? C : ((i % 3 == 1) ? D : World);
+    points.emplace_back(parent, RandomVector<LinearVector>(10.0));
+  }
+
+  std::vector<LinearVector> resolved;
+  for (const FrameID &relativeTo : {World, C, D})
+  {
+    for (const FrameID &inCoordinatesOf : {World, C, D})
+    {
+      fs->Resolve(points, resolved, relativeTo, inCoordinatesOf);
+      ASSERT_EQ(points.size(), resolved.size());
+      for (std::size_t i = 0; i < points.size(); ++i)
+      {
+        EXPECT_TRUE(Equal(fs->Resolve(points[i], relativeTo, inCoordinatesOf),
+                          resolved[i], _tolerance));
+      }
+    }
+  }
+
+  std::vector<RelativePosition> reframed;
+  fs->Reframe(points, reframed, D);
+  ASSERT_EQ(points.size(), reframed.size());
+  for (std::size_t i = 0; i < points.size(); ++i)
+  {
+    EXPECT_EQ(D, reframed[i].ParentFrame());
+    EXPECT_TRUE(Equal(fs->Resolve(points[i], World),
+                      fs->Resolve(reframed[i], World), _tolerance));
+  }
 }
 
 /////////////////////////////////////////////////